@@ -0,0 +1,80 @@
+#pragma once
+
+#include "raylib.h"
+#include "MappedFile.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Asset Pack - Pre-decoded images in a single file
+// Built offline by EpitomePacker (tools/packer) from the loose sprite PNGs and
+// memory-mapped at runtime: loading a sprite is a directory lookup and a
+// texture upload, with no PNG decode and no per-file probing.
+//
+// Layout (little-endian):
+//   Header
+//   Entry[entryCount]             sorted by name
+//   payloads                      each PAYLOAD_ALIGNMENT-aligned, RGBA8 rows
+// ============================================================================
+namespace AssetPack {
+    constexpr uint32_t MAGIC = 0x4B415045;  // "EPAK"
+    constexpr uint32_t VERSION = 1;
+    constexpr int NAME_LENGTH = 32;          // Including the terminator
+    constexpr size_t PAYLOAD_ALIGNMENT = 64;
+
+    enum class Compression : uint32_t {
+        NONE = 0,
+        LZ4 = 1     // Reserved for the format; neither the packer nor the reader implements it yet
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t reserved;
+    };
+
+    struct Entry {
+        char name[NAME_LENGTH];   // SpriteManager::GetSpriteName of the sprite
+        int32_t width;
+        int32_t height;
+        int32_t format;           // raylib PixelFormat of the payload
+        Compression compression;
+        uint64_t offset;          // From the start of the file
+        uint64_t size;            // Stored bytes
+    };
+
+    static_assert(sizeof(Header) == 16, "Pack header layout is part of the file format");
+    static_assert(sizeof(Entry) == 64, "Pack entry layout is part of the file format");
+
+    // One image to write; the image is converted to RGBA8 on the way out
+    struct Source {
+        std::string name;
+        Image image;
+    };
+
+    // Write a pack (false on I/O error or a name that doesn't fit)
+    bool Write(const std::string& path, const std::vector<Source>& sources);
+}
+
+// ============================================================================
+// Asset Pack Reader - A mapped, validated pack
+// Images returned by GetImage point straight into the mapping: they are valid
+// while the reader stays open and must not be passed to UnloadImage.
+// ============================================================================
+class AssetPackReader {
+public:
+    bool Open(const std::string& path);  // Maps and validates the whole directory
+    void Close();
+
+    bool IsOpen() const { return m_file.IsOpen(); }
+    int GetEntryCount() const { return static_cast<int>(m_entries.size()); }
+
+    const AssetPack::Entry* Find(const char* name) const;  // nullptr if absent
+    Image GetImage(const AssetPack::Entry& entry) const;
+
+private:
+    MappedFile m_file;
+    std::vector<AssetPack::Entry> m_entries;  // Copied out so the mapping's alignment doesn't matter
+};
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "raylib.h"
+#include "Visibility.hpp"
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <random>
@@ -46,19 +49,55 @@ struct Door {
 class Room {
 public:
     Room(int id, RoomType type, int gridX, int gridY);
+    ~Room();
+    Room(const Room&) = delete;
+    Room& operator=(const Room&) = delete;
     
     void Generate(unsigned int seed);
-    void Render(Vector2 offset);
+    void Render(Vector2 offset, Rectangle view);  // view: world-space area to draw (camera bounds)
+    
+    // Tile layer cache: the static tiles baked into one render texture, drawn
+    // as a single quad. Baking switches render targets, so UpdateTileCache()
+    // must run outside BeginMode2D; Render() draws tiles directly until the
+    // cache is up to date.
+    void UpdateTileCache();
+    void ReleaseTileCache();
     
     // Tile access
-    TileType GetTile(int x, int y) const;
+    TileType GetTile(int x, int y) const {
+        if (!InBounds(x, y)) return TileType::VOID;
+        return static_cast<TileType>(m_tiles[y * WIDTH + x]);
+    }
     void SetTile(int x, int y, TileType tile);
-    bool IsWalkable(int x, int y) const;
+    
+    // Walkability is a precomputed bit per tile (FLOOR or DOOR), one 16-bit
+    // mask per row, so a lookup is a bounds check plus one shift and mask
+    bool IsWalkable(int x, int y) const {
+        return InBounds(x, y) && ((m_walkableRows[y] >> x) & 1u);
+    }
+    bool IsWalkableAt(Vector2 worldPos) const {
+        int x, y;
+        return WorldToTile(worldPos, x, y) && ((m_walkableRows[y] >> x) & 1u);
+    }
+    uint16_t GetWalkableRow(int y) const { return m_walkableRows[y]; }
+    
+    // Tile-to-tile line of sight, see Visibility::HasLineOfSight
+    const VisibilityTable& GetVisibility() const { return m_visibility; }
     
     // World position conversion
-    Vector2 GetWorldPosition() const;
+    Vector2 GetWorldPosition() const {
+        return {
+            static_cast<float>(m_gridX * WIDTH * TILE_SIZE),
+            static_cast<float>(m_gridY * HEIGHT * TILE_SIZE)
+        };
+    }
     Vector2 TileToWorld(int tileX, int tileY) const;
-    bool WorldToTile(Vector2 worldPos, int& tileX, int& tileY) const;
+    bool WorldToTile(Vector2 worldPos, int& tileX, int& tileY) const {
+        Vector2 roomPos = GetWorldPosition();
+        tileX = static_cast<int>((worldPos.x - roomPos.x) / TILE_SIZE);
+        tileY = static_cast<int>((worldPos.y - roomPos.y) / TILE_SIZE);
+        return InBounds(tileX, tileY);
+    }
     
     // Properties
     int GetId() const { return m_id; }
@@ -66,7 +105,10 @@ public:
     int GetGridX() const { return m_gridX; }
     int GetGridY() const { return m_gridY; }
     bool IsCleared() const { return m_cleared; }
-    void SetCleared(bool cleared) { m_cleared = cleared; }
+    void SetCleared(bool cleared) {
+        if (cleared != m_cleared) ++m_tileRevision;  // Door colour changes
+        m_cleared = cleared;
+    }
     bool IsVisited() const { return m_visited; }
     void SetVisited(bool visited) { m_visited = visited; }
     
@@ -89,6 +131,7 @@ public:
     static constexpr int WIDTH = 15;
     static constexpr int HEIGHT = 11;
     static constexpr int TILE_SIZE = 48;
+    static_assert(WIDTH <= 16, "m_walkableRows packs a row into 16 bits; widen its element type first");
     
 private:
     int m_id;
@@ -97,7 +140,22 @@ private:
     bool m_cleared = false;
     bool m_visited = false;
     
-    std::vector<std::vector<TileType>> m_tiles;
+    static bool InBounds(int x, int y) {
+        return static_cast<unsigned>(x) < static_cast<unsigned>(WIDTH) && 
+               static_cast<unsigned>(y) < static_cast<unsigned>(HEIGHT);
+    }
+    void RebuildWalkability();
+    int RenderTiles(Vector2 offset, Rectangle view) const;  // Returns the number of draw calls issued
+    void RenderProps(Vector2 offset);       // Treasure, shop items (animated, drawn every frame)
+    
+    std::array<uint8_t, WIDTH * HEIGHT> m_tiles;  // TileType per tile, row-major
+    std::array<uint16_t, HEIGHT> m_walkableRows;   // Bit x of row y set = walkable
+    VisibilityTable m_visibility;
+    
+    // Tile layer cache
+    RenderTexture2D m_tileCache = {0};
+    uint32_t m_tileRevision = 1;       // Bumped whenever the tile layer's look changes
+    uint32_t m_bakedRevision = 0;      // Revision in m_tileCache (0 = nothing baked)
     std::vector<Door> m_doors;
     std::vector<Vector2> m_enemySpawns;
     Vector2 m_playerSpawn;
@@ -109,16 +167,17 @@ private:
 class DungeonManager {
 public:
     DungeonManager();
-    ~DungeonManager() = default;
+    ~DungeonManager();
     
     void Generate(unsigned int seed, int stage, int subLevel);
     void Update(float dt);
-    void Render();
-    void RenderMinimap(float x, float y, float scale);
+    void PrepareRender();  // Bake caches; call before BeginMode2D
+    void Render(Rectangle view);  // Only what overlaps view (world space) is drawn
+    void RenderMinimap(float x, float y, float scale);  // Screen space; call outside BeginMode2D
     
     // Room access
     Room* GetCurrentRoom() { return m_currentRoom; }
-    Room* GetRoom(int id);
+    Room* GetRoom(int id);  // O(1) through the id index
     const std::vector<std::unique_ptr<Room>>& GetAllRooms() const { return m_rooms; }
     void SetCurrentRoom(int id);
     void TransitionToRoom(int roomId, int fromDirection);
@@ -141,12 +200,29 @@ public:
     void ActivatePortal();
     Vector2 GetPortalPosition() const { return m_portalPosition; }
     
+    // Room tile caching (debug toggle, on by default)
+    bool IsTileCacheEnabled() const { return m_tileCacheEnabled; }
+    void SetTileCacheEnabled(bool enabled) { m_tileCacheEnabled = enabled; }
+    
 private:
     void GenerateLayout(unsigned int seed);
     void ConnectRooms();
+    void IndexRooms();
+    void BakeMinimap(float scale);
+    void DrawMinimap(float x, float y, float scale);
+    void ReleaseMinimap();
     
     std::vector<std::unique_ptr<Room>> m_rooms;
+    std::vector<Room*> m_roomsById;  // Indexed by room id; null where no room has that id
     Room* m_currentRoom = nullptr;
+    Room* m_cachedRoom = nullptr;  // Only the current room keeps a baked tile layer
+    bool m_tileCacheEnabled = true;
+    
+    // Minimap cache, rebaked only when the layout, current room or visited set changes
+    RenderTexture2D m_minimapCache = {0};
+    uint32_t m_minimapRevision = 1;        // Bumped whenever the minimap's look changes
+    uint32_t m_minimapBakedRevision = 0;   // Revision in m_minimapCache (0 = nothing baked)
+    float m_minimapBakedScale = 0.0f;
     int m_stage = 1;
     int m_subLevel = 1;
     
@@ -1,114 +1,227 @@
 #pragma once
 
-#include "Entity.hpp"
+#include "raylib.h"
+#include "raymath.h"
 #include "Pathfinding.hpp"
+#include "EnemyRegistry.hpp"
+#include "SpatialGrid.hpp"
+#include <cstdint>
+#include <deque>
 #include <vector>
-#include <memory>
-#include <string>
 
-enum class EnemyType {
-    SLIME,          // Basic melee, slow
-    SKELETON,       // Ranged, stationary shooter  
-    BAT,            // Fast, erratic movement
-    GOBLIN,         // Melee, charges at player
-    MINI_BOSS_GOLEM // Tanky, AoE attacks
+class Player;
+class DungeonManager;
+class Room;
+
+// ============================================================================
+// AI think scheduling
+// Decisions (line of sight, state changes, reposition sampling, attacks) run
+// at a rate picked per enemy each tick; movement along the current state's
+// route still integrates every tick. Full rate: ATTACK, and CHASE/REPOSITION
+// within nearDistance of the player. Everyone else is time-sliced into
+// buckets by id so their thinks spread evenly over the interval, and at most
+// maxScheduledThinks of those run per tick; the rest stay due and are served
+// round robin on the following ticks. Full-rate thinks are never deferred.
+// The budget is per simulation tick, not per rendered frame: catch-up ticks
+// each get their own, so the outcome doesn't depend on the frame rate.
+// ============================================================================
+struct EnemyAISchedule {
+    bool enabled = true;           // False: every enemy thinks every tick
+    float nearDistance = 360.0f;   // Player distance that keeps an active enemy at full rate
+    int farInterval = 4;           // Ticks between thinks: CHASE / REPOSITION beyond nearDistance
+    int idleInterval = 8;          // Ticks between thinks: IDLE and SEARCH (both rounded down to a power of two)
+    int maxScheduledThinks = 128;  // Reduced-rate thinks per tick (<= 0: no cap)
 };
 
-struct EnemyData {
-    EnemyType type;
-    std::string name;
-    int maxHealth;
-    float moveSpeed;
-    int damage;
-    float attackCooldown;
-    float detectionRange;
-    int currencyDrop;
-    Color color;
+// What the scheduler did in the last Update()
+struct EnemyAIStats {
+    int fullRate = 0;   // Thinks at full rate
+    int scheduled = 0;  // Reduced-rate thinks that ran
+    int deferred = 0;   // Reduced-rate thinks pushed to the next tick by the budget
+    int steered = 0;    // Enemies that only moved
 };
 
-class Enemy : public Entity {
-public:
-    Enemy(const EnemyData& data, Vector2 pos);
-    ~Enemy() override = default;
-    
-    void Update(float dt) override;
-    void Render() override;
-    
-    void TakeDamage(int amount);
-    bool IsDead() const { return m_health <= 0; }
-    
-    // Status effects
-    void Immobilize(float duration);
-    bool IsImmobilized() const { return m_immobilizeTimer > 0.0f; }
-    
-    const EnemyData& GetData() const { return m_data; }
-    int GetHealth() const { return m_health; }
-    int GetMaxHealth() const { return m_data.maxHealth; }
-    
-    // Factory methods
-    static EnemyData CreateSlimeData();
-    static EnemyData CreateSkeletonData();
-    static EnemyData CreateBatData();
-    static EnemyData CreateGoblinData();
-    static EnemyData CreateGolemData();
-    
-protected:
-    virtual void UpdateAI(float dt);
-    virtual void Attack();
-    float GetAttackRange() const;
-    float GetPreferredDistance() const;  // For ranged enemies to maintain distance
-    bool HasLineOfSight() const;
-    Vector2 FindRepositionTarget() const;
-    
-    EnemyData m_data;
-    int m_health;
-    float m_attackTimer = 0.0f;
-    float m_stateTimer = 0.0f;
-    float m_repositionTimer = 0.0f;  // Timer for repositioning behavior
-    Vector2 m_repositionTarget = {0, 0};  // Target position for repositioning
-    Vector2 m_lastKnownPlayerPos = {0, 0};  // Last known player position
-    float m_searchTimer = 0.0f;  // Timer for searching behavior
-    float m_immobilizeTimer = 0.0f;  // Timer for immobilize effect
-    
-    // Pathfinding - Using Seeker component (similar to Unity's A* Pathfinding)
-    Seeker m_seeker;              // Handles path requests and waypoint management
-    AIPathHelper m_pathHelper;     // Handles movement along the path
-    
-    // Legacy support (for gradual migration)
-    std::vector<Vector2> m_currentPath;
-    float m_pathUpdateTimer = 0.0f;
-    static constexpr float PATH_UPDATE_INTERVAL = 0.3f;  // Update path every 0.3 seconds
-    
-    // Movement helper
-    void MoveAlongPath(float dt, float speedMultiplier = 1.0f);
-    void UpdatePath(Vector2 targetPos);
-    
-    // New Seeker-based movement (preferred)
-    void MoveWithSeeker(Vector2 targetPos, float dt, float speedMultiplier = 1.0f);
-    
-    // AI state
-    enum class AIState { IDLE, CHASE, ATTACK, SPECIAL, REPOSITION, SEARCH };
-    AIState m_aiState = AIState::IDLE;
+// ============================================================================
+// Crowd steering
+// Separation applied to every step an enemy takes along the flow field or a
+// path, after the desired move is known and before the walkability check:
+// each overlapping neighbour pushes the step away in proportion to how deep
+// the overlap is, and the result is capped at the enemy's speed. Neighbours
+// come from a grid of tick-start positions, and a query stops after
+// maxCandidates ids or maxNeighbors overlaps, so a packed crowd costs the
+// same per enemy as a sparse one. Enemies standing still aren't pushed.
+// ============================================================================
+struct EnemyCrowdSteering {
+    bool enabled = true;
+    float padding = 4.0f;          // Extra gap kept between radii
+    float separationWeight = 1.5f; // Push at full overlap, in max steps
+    int maxNeighbors = 8;          // Overlaps counted per query
+    int maxCandidates = 32;        // Grid ids examined per query
 };
 
+// ============================================================================
+// Enemy Manager - Structure-of-arrays enemy pool
+// Every live enemy is a slot index into parallel arrays; the fields the AI
+// and collision passes touch every tick sit in dense arrays, per-type stats
+// live once in the EnemyRegistry and are referenced by archetype index. Dead
+// enemies are compacted out in Update() with their relative order kept, so
+// slot indices change then (use GetId() to follow one enemy across ticks).
+//
+// Update() thinks and moves enemies in chunks on the JobSystem. That pass
+// only writes each enemy's own slot; anything touching shared state (player
+// damage, projectiles, the global RNG, path requests) is recorded per chunk
+// and applied on the game thread afterwards, in slot order, so the result
+// is the same for any worker count.
+// ============================================================================
 class EnemyManager {
 public:
-    EnemyManager() = default;
+    EnemyManager();
     ~EnemyManager() = default;
     
     void Update(float dt);
-    void Render();
     void Clear();
     
-    void SpawnEnemy(EnemyType type, Vector2 pos);
+    // Draw enemies overlapping view (world space). grid, when given, must have
+    // been built from slot indices at the current roster version; otherwise
+    // every enemy is tested.
+    void Render(Rectangle view, const SpatialGrid* grid = nullptr);
+    
+    // Bumped whenever enemies are added or removed (invalidates index-keyed data)
+    uint32_t GetRosterVersion() const { return m_rosterVersion; }
+    
+    void SpawnEnemy(int archetype, Vector2 pos);  // EnemyRegistry index
+    void SpawnEnemy(EnemyType type, Vector2 pos) { SpawnEnemy(static_cast<int>(type), pos); }
     void SpawnEnemiesInRoom(const std::vector<Vector2>& spawnPoints, int difficulty);
     
-    std::vector<std::unique_ptr<Enemy>>& GetEnemies() { return m_enemies; }
+    // Slot access (0 .. GetCount()-1)
+    int GetCount() const { return static_cast<int>(m_position.size()); }
+    uint32_t GetId(int i) const { return m_id[i]; }  // Never 0, never reused
+    int FindById(uint32_t id) const;                // Slot index, -1 once the enemy is gone
+    Vector2 GetPosition(int i) const { return m_position[i]; }
+    Vector2 GetRenderPosition(int i, float alpha) const { return Vector2Lerp(m_prevPosition[i], m_position[i], alpha); }
+    float GetRadius(int i) const { return m_radius[i]; }
+    int GetHealth(int i) const { return m_health[i]; }
+    int GetMaxHealth(int i) const { return GetData(i).maxHealth; }
+    int GetArchetype(int i) const { return m_archetype[i]; }
+    const EnemyData& GetData(int i) const { return EnemyRegistry::Instance().Get(m_archetype[i]); }
+    bool IsDead(int i) const { return m_health[i] <= 0; }
+    bool IsImmobilized(int i) const { return m_immobilizeTimer[i] > 0.0f; }
+    
+    void TakeDamage(int i, int amount);
+    void Immobilize(int i, float duration) { m_immobilizeTimer[i] = duration; }
+    
     int GetActiveCount() const;
     
-    // For auto-aim
-    Enemy* GetNearestEnemy(Vector2 pos, float maxRange);
+    // For auto-aim (optionally only enemies visible from pos). Slot index, -1 if none
+    int GetNearestEnemy(Vector2 pos, float maxRange, bool requireLineOfSight = false) const;
+    
+    // Shared navigation toward the player, refreshed in Update()
+    const FlowField& GetPlayerFlowField() const { return m_playerField; }
+    
+    EnemyAISchedule aiSchedule;
+    const EnemyAIStats& GetAIStats() const { return m_aiStats; }
+    
+    EnemyCrowdSteering crowd;
     
 private:
-    std::vector<std::unique_ptr<Enemy>> m_enemies;
+    enum class AIState : uint8_t { IDLE, CHASE, ATTACK, SPECIAL, REPOSITION, SEARCH };
+    
+    static constexpr float PATH_UPDATE_INTERVAL = 0.3f;   // Update path every 0.3 seconds
+    static constexpr float WAYPOINT_PICK_DISTANCE = 20.0f;
+    
+    // A* state for enemies that need more than the flow field. Pooled and
+    // handed out on first use (in ApplyCommands, the pool only grows on the
+    // game thread): seekers must not move while a request is out, so they
+    // live in a deque and enemies refer to them by index.
+    struct NavState {
+        Seeker seeker;
+        std::vector<Vector2> fallbackPath;  // Last delivered path, followed when the seeker drops its own
+    };
+    
+    // Side effect of the parallel pass, applied by ApplyCommands()
+    struct EnemyCommand {
+        enum class Type : uint8_t {
+            DAMAGE_PLAYER,     // The archetype's damage
+            SPAWN_PROJECTILE,  // From position along direction
+            PICK_REPOSITION,   // m_repositionTarget = FindRepositionTarget() (shared RNG)
+            ROLL_REPOSITION,   // Ranged enemies' chance to reposition after attacking (shared RNG)
+            REQUEST_PATH,      // First path for an enemy without a nav: position -> target
+            SUBMIT_PATH        // Queue the seeker's deferred path request
+        };
+        Type type;
+        int slot;
+        Vector2 position = {0, 0};
+        Vector2 direction = {0, 0};
+        Vector2 target = {0, 0};
+    };
+    using CommandBuffer = std::vector<EnemyCommand>;
+    
+    static constexpr int UPDATE_CHUNK = 256;  // Enemies per job
+    
+    void UpdateEnemy(int i, float dt, CommandBuffer& out);
+    void UpdateAI(int i, float dt, CommandBuffer& out);  // Full think: senses, changes state, attacks, moves
+    void Steer(int i, float dt, CommandBuffer& out);     // Movement only, for ticks without a think
+    void ScheduleThinks();                               // Fills m_thinkNow for this tick
+    void Attack(int i, CommandBuffer& out);
+    void ApplyCommands(int chunks);
+    bool HasLineOfSight(int i) const;
+    Vector2 FindRepositionTarget(int i) const;
+    
+    // Movement
+    void ChaseStep(int i, float dt, CommandBuffer& out);
+    void RepositionStep(int i, float dt, CommandBuffer& out);
+    void SearchStep(int i, float dt, CommandBuffer& out);
+    bool UpdatePath(int i, Vector2 targetPos, CommandBuffer& out);  // True if a request went out
+    void StartPath(int i, Vector2 from, Vector2 targetPos);
+    void MoveAlongPath(int i, float dt, CommandBuffer& out, float speedMultiplier = 1.0f);
+    bool MoveAlongFlowField(int i, float dt, float speedMultiplier = 1.0f);  // False if the field can't guide us
+    Vector2 SteerCrowd(int i, Vector2 desiredPos, float maxStep) const;     // Separated step, desiredPos if blocked
+    void BuildCrowdGrid();
+    void ClearPath(int i);  // Drops the fallback path only (the A* path is left to the seeker)
+    
+    int AcquireNav(int i);
+    void ReleaseNav(int nav);
+    void RemoveDead();
+    
+    // Hot (touched every tick)
+    std::vector<Vector2> m_position;
+    std::vector<Vector2> m_prevPosition;  // Position before the last step (render interpolation)
+    std::vector<float> m_radius;
+    std::vector<int> m_health;
+    std::vector<uint16_t> m_archetype;
+    std::vector<AIState> m_state;
+    std::vector<float> m_attackTimer;
+    std::vector<float> m_repositionTimer;
+    std::vector<float> m_searchTimer;
+    std::vector<float> m_immobilizeTimer;
+    std::vector<float> m_pathUpdateTimer;
+    std::vector<uint8_t> m_thinkOverdue;  // Due on an earlier tick but over budget
+    
+    // Cold
+    std::vector<Vector2> m_repositionTarget;
+    std::vector<Vector2> m_lastKnownPlayerPos;
+    std::vector<int> m_nav;  // Index into m_navPool, -1 until the enemy first needs A*
+    std::vector<uint32_t> m_id;
+    
+    std::deque<NavState> m_navPool;
+    std::vector<int> m_freeNav;
+    
+    // Snapshot taken at the start of Update() for the per-enemy passes
+    Player* m_player = nullptr;
+    DungeonManager* m_dungeon = nullptr;
+    Room* m_room = nullptr;
+    
+    FlowField m_playerField;
+    uint32_t m_rosterVersion = 0;
+    uint32_t m_nextId = 1;
+    std::vector<int> m_visible;  // Render scratch
+    std::vector<CommandBuffer> m_commandBuffers;  // One per chunk, reused
+    SpatialGrid m_crowdGrid;  // Living enemies at m_prevPosition by slot, one-tile cells
+    
+    // Think scheduling
+    std::vector<uint8_t> m_thinkNow;      // Per slot, this tick only
+    std::vector<int> m_thinkCandidates;   // Reduced-rate enemies due this tick
+    uint32_t m_aiTick = 0;
+    uint32_t m_thinkCursor = 0;           // Id the budget starts granting from (round robin)
+    EnemyAIStats m_aiStats;
 };
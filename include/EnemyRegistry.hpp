@@ -0,0 +1,101 @@
+#pragma once
+
+#include "raylib.h"
+#include "SpriteManager.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Built-in archetypes; each one's registry index is its enumerator value.
+// Data files can override these and append more (see EnemyRegistry).
+enum class EnemyType {
+    SLIME,          // Basic melee, slow
+    SKELETON,       // Ranged, stationary shooter
+    BAT,            // Fast, erratic movement
+    GOBLIN,         // Melee, charges at player
+    MINI_BOSS_GOLEM // Tanky, AoE attacks
+};
+
+enum class EnemyAttack : uint8_t {
+    MELEE,   // Damage on contact
+    RANGED,  // Fires a projectile, keeps its distance
+    STOMP    // Damage anywhere within attackRange
+};
+
+// Where SpawnEnemiesInRoom may draw an archetype from
+enum class EnemySpawnRole : uint8_t {
+    NONE,      // Only spawned explicitly
+    MINION,    // Room waves; later entries unlock at higher difficulty
+    MINIBOSS   // Occasional extra on harder floors
+};
+
+struct EnemyData {
+    std::string key;   // Section name in the data file
+    std::string name;
+    int maxHealth = 30;
+    float moveSpeed = 50.0f;
+    int damage = 5;
+    float attackCooldown = 1.5f;
+    float detectionRange = 200.0f;
+    int currencyDrop = 5;
+    Color color = WHITE;
+
+    // Behaviour
+    EnemyAttack attack = EnemyAttack::MELEE;
+    float attackRange = 30.0f;
+    float preferredDistance = 30.0f;     // How close the AI tries to stay
+    float projectileSpeed = 200.0f;      // RANGED only
+    Color projectileColor = PURPLE;      // RANGED only
+    float radius = 20.0f;
+    SpriteType sprite = SpriteType::COUNT;  // COUNT = none, always drawn as a circle
+    EnemySpawnRole spawnRole = EnemySpawnRole::NONE;
+};
+
+// ============================================================================
+// Enemy Registry - One immutable archetype per enemy kind
+// Loaded once at startup; enemies refer to their archetype by index and never
+// copy it. The built-in table matches assets/data/enemies.ini, so a missing
+// file plays the same. The file can retune the built-ins and add new kinds
+// (new sections are appended after the built-ins, in file order):
+//
+//   [wraith]
+//   name = Wraith
+//   health = 35
+//   attack = ranged          ; melee | ranged | stomp
+//   color = 120, 200, 255
+//   sprite = enemy_bat       ; any sprite file name, or none
+//   spawn = minion           ; none | minion | miniboss
+//
+// Don't reload while enemies are alive: indices and references handed out
+// stay valid only until the next Load/Reset.
+// ============================================================================
+class EnemyRegistry {
+public:
+    static EnemyRegistry& Instance();
+
+    // Reset to the built-ins, then apply the file on top. False if the file
+    // could not be opened (the built-ins stay in place).
+    bool Load(const std::string& path);
+    void Reset();
+
+    int GetCount() const { return static_cast<int>(m_archetypes.size()); }
+    const EnemyData& Get(int index) const { return m_archetypes[index]; }
+    const EnemyData& Get(EnemyType type) const { return m_archetypes[static_cast<int>(type)]; }
+    int Find(const std::string& key) const;  // -1 if unknown
+
+    // Archetype indices SpawnEnemiesInRoom draws from, in registry order
+    const std::vector<int>& GetSpawnPool(EnemySpawnRole role) const;
+
+private:
+    EnemyRegistry();
+    EnemyRegistry(const EnemyRegistry&) = delete;
+    EnemyRegistry& operator=(const EnemyRegistry&) = delete;
+
+    bool ApplyField(EnemyData& data, const std::string& field, const std::string& value);
+    void RebuildSpawnPools();
+
+    std::vector<EnemyData> m_archetypes;
+    std::vector<int> m_minions;
+    std::vector<int> m_minibosses;
+    std::vector<int> m_noPool;
+};
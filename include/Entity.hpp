@@ -6,15 +6,20 @@
 class Entity {
 public:
     Entity() = default;
-    Entity(Vector2 pos, float radius) : m_position(pos), m_radius(radius) {}
+    Entity(Vector2 pos, float radius) : m_position(pos), m_prevPosition(pos), m_radius(radius) {}
     virtual ~Entity() = default;
     
     virtual void Update(float dt) = 0;
     virtual void Render() = 0;
     
-    // Position
+    // Position (SetPosition teleports - no interpolation from the old spot)
     Vector2 GetPosition() const { return m_position; }
-    void SetPosition(Vector2 pos) { m_position = pos; }
+    void SetPosition(Vector2 pos) { m_position = pos; m_prevPosition = pos; }
+    
+    // Render interpolation: the sim runs at a fixed step, frames land
+    // between steps. Store before each step, lerp by the frame's alpha.
+    void StorePreviousPosition() { m_prevPosition = m_position; }
+    Vector2 GetRenderPosition(float alpha) const { return Vector2Lerp(m_prevPosition, m_position, alpha); }
     
     // Velocity
     Vector2 GetVelocity() const { return m_velocity; }
@@ -25,10 +30,10 @@ public:
     bool IsActive() const { return m_active; }
     void SetActive(bool active) { m_active = active; }
     
-    // Simple circle collision
+    // Simple circle collision (squared distance, no sqrt)
     bool CollidesWith(const Entity& other) const {
-        float dist = Vector2Distance(m_position, other.m_position);
-        return dist < (m_radius + other.m_radius);
+        float reach = m_radius + other.m_radius;
+        return Vector2DistanceSqr(m_position, other.m_position) < reach * reach;
     }
     
     Rectangle GetBounds() const {
@@ -38,6 +43,7 @@ public:
 
 protected:
     Vector2 m_position = {0, 0};
+    Vector2 m_prevPosition = {0, 0};
     Vector2 m_velocity = {0, 0};
     float m_radius = 16.0f;
     bool m_active = true;
@@ -2,6 +2,9 @@
 
 #include "raylib.h"
 #include "Player.hpp"
+#include "Input.hpp"
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -11,6 +14,7 @@ class DungeonManager;
 class EnemyManager;
 class ProjectileManager;
 class UIManager;
+class SpatialGrid;
 
 enum class GameState {
     MENU,
@@ -23,18 +27,38 @@ enum class GameState {
     FLOOR_CLEAR
 };
 
+// Startup options
+struct GameConfig {
+    bool headless = false;       // No window, no GPU: simulation only (Render() is never called)
+    unsigned int seed = 0;       // Dungeon seed (0 = time-based)
+    int pathWorkers = -1;        // Path search threads (-1 = pick from core count, 0 = run on game thread)
+    int jobWorkers = -1;         // Job system threads besides the game thread (-1 = pick from core count, 0 = none)
+    int tickRate = 120;          // Fixed simulation steps per second
+    int maxCatchUpSteps = 8;     // Steps per frame before the loop drops time instead of spiralling
+    const char* tracePath = nullptr; // Profiler trace file; if set it is also written at Shutdown
+    const char* enemyDataPath = "assets/data/enemies.ini"; // Enemy archetypes (built-ins if missing)
+};
+
 class Game {
 public:
     static Game& Instance();
     
-    void Init();
+    void Init(const GameConfig& config = GameConfig());
     void Run();
     void Shutdown();
     
+    // Advance the simulation by one frame without rendering (used by Run and headless drivers)
+    void Tick(float dt);
+    bool IsHeadless() const { return m_config.headless; }
+    
     void SetState(GameState state) { m_state = state; }
     GameState GetState() const { return m_state; }
     
     float GetDeltaTime() const { return m_deltaTime; }
+    float GetFixedStep() const { return 1.0f / static_cast<float>(m_config.tickRate); }
+    
+    // How far the rendered frame sits between the previous and current step (0..1)
+    float GetInterpolationAlpha() const { return m_interpolationAlpha; }
     
     Player* GetPlayer() { return m_player.get(); }
     DungeonManager* GetDungeon() { return m_dungeon.get(); }
@@ -47,6 +71,9 @@ public:
     void EnterPortal();  // Start run from hub
     void ReturnToHub();  // Return to hub after run results
     void ApplyFloorBuff(int buffIndex); // Apply selected floor buff and continue
+    int GetStartingBuffCount() const { return static_cast<int>(m_startingBuffs.size()); }
+    int GetCurrentStage() const { return m_currentStage; }
+    int GetCurrentSubLevel() const { return m_currentSubLevel; }
     
     // Debug menu
     bool IsDebugMenuOpen() const { return m_debugMenuOpen; }
@@ -56,6 +83,7 @@ public:
     void DebugClearEnemies();
     void DebugChangeCharacter(CharacterType type);
     void DebugEndGame();
+    void SaveProfilerTrace();  // Chrome trace of the profiler's buffered zones
     
     // Screen dimensions
     static constexpr int SCREEN_WIDTH = 1280;
@@ -79,11 +107,24 @@ private:
     void CheckPortalEntry();  // Check if player enters portal
     void ShowBuffSelection(); // Show buff selection screen
     void ShowFloorBuffSelection(); // Show floor clear buff selection
+    unsigned int NextDungeonSeed();
+    
+    GameConfig m_config;
+    unsigned int m_floorsGenerated = 0;
     
     GameState m_state = GameState::MENU;
     float m_deltaTime = 0.0f;
     bool m_running = false;
     
+    // Fixed-step loop
+    float m_accumulator = 0.0f;
+    float m_interpolationAlpha = 1.0f;
+    LatchedInputProvider m_tickInput;
+    
+    // Startup timing (time to first presented frame)
+    std::chrono::steady_clock::time_point m_initStart;
+    bool m_firstFrameLogged = false;
+    
     // Hub state
     CharacterType m_selectedCharacter = CharacterType::TERRORIST;
     Rectangle m_portalBounds = {0};
@@ -108,9 +149,19 @@ private:
     std::unique_ptr<ProjectileManager> m_projectiles;
     std::unique_ptr<UIManager> m_ui;
     
+    // Collision broadphase, rebuilt from the enemy list every frame; also
+    // culls enemy drawing while the roster hasn't changed since the build
+    std::unique_ptr<SpatialGrid> m_enemyGrid;
+    uint32_t m_enemyGridVersion = UINT32_MAX;  // Roster version at the last build
+    
     // Starting buff selection
     std::vector<BuffData> m_startingBuffs;
     
     // Camera for dungeon view
     Camera2D m_camera = {0};
+    
+    // World-space area the camera shows, padded by VIEW_MARGIN so health
+    // bars, trails and sprite overhang at the edges still draw
+    Rectangle GetCameraView() const;
+    static constexpr float VIEW_MARGIN = 64.0f;
 };
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "raylib.h"
+#include <bitset>
+#include <unordered_set>
+
+// ============================================================================
+// Input Provider - Source of keyboard/mouse state
+// Gameplay code reads input through Input:: instead of raylib directly so the
+// simulation can be driven by a script (headless runs, soak tests, bots).
+// ============================================================================
+class IInputProvider {
+public:
+    virtual ~IInputProvider() = default;
+
+    virtual bool IsKeyDown(int key) const = 0;
+    virtual bool IsKeyPressed(int key) const = 0;
+    virtual bool IsMouseButtonDown(int button) const = 0;
+    virtual bool IsMouseButtonPressed(int button) const = 0;
+    virtual Vector2 GetMousePosition() const = 0;
+};
+
+// Default provider - forwards to raylib (requires an open window)
+class RaylibInputProvider : public IInputProvider {
+public:
+    bool IsKeyDown(int key) const override { return ::IsKeyDown(key); }
+    bool IsKeyPressed(int key) const override { return ::IsKeyPressed(key); }
+    bool IsMouseButtonDown(int button) const override { return ::IsMouseButtonDown(button); }
+    bool IsMouseButtonPressed(int button) const override { return ::IsMouseButtonPressed(button); }
+    Vector2 GetMousePosition() const override { return ::GetMousePosition(); }
+};
+
+// Scripted provider - state is set from code (bots, replays, tests)
+// "Pressed" events last until EndFrame() is called.
+class ScriptedInputProvider : public IInputProvider {
+public:
+    void SetKeyDown(int key, bool down);
+    void PressKey(int key);
+    void SetMouseButtonDown(int button, bool down);
+    void PressMouseButton(int button);
+    void SetMousePosition(Vector2 pos) { m_mousePosition = pos; }
+
+    // Release everything that is held
+    void ReleaseAll();
+
+    // Clear one-shot pressed events (call once per simulated frame)
+    void EndFrame();
+
+    bool IsKeyDown(int key) const override { return m_keysDown.count(key) > 0; }
+    bool IsKeyPressed(int key) const override { return m_keysPressed.count(key) > 0; }
+    bool IsMouseButtonDown(int button) const override { return m_buttonsDown.count(button) > 0; }
+    bool IsMouseButtonPressed(int button) const override { return m_buttonsPressed.count(button) > 0; }
+    Vector2 GetMousePosition() const override { return m_mousePosition; }
+
+private:
+    std::unordered_set<int> m_keysDown;
+    std::unordered_set<int> m_keysPressed;
+    std::unordered_set<int> m_buttonsDown;
+    std::unordered_set<int> m_buttonsPressed;
+    Vector2 m_mousePosition = {0, 0};
+};
+
+// Latched provider - wraps another provider for the fixed-step loop
+// A frame may run zero simulation steps, so one-shot presses seen during the
+// frame are held until a step consumes them. Held state and the mouse
+// position are read straight from the source.
+class LatchedInputProvider : public IInputProvider {
+public:
+    static constexpr int MAX_KEYS = 512;
+    static constexpr int MAX_MOUSE_BUTTONS = 8;
+
+    // Latch this frame's presses from source (call once per rendered frame)
+    void Poll(IInputProvider& source);
+
+    // Drop latched presses (call after each simulation step)
+    void ConsumePressed();
+
+    bool IsKeyDown(int key) const override { return m_source && m_source->IsKeyDown(key); }
+    bool IsKeyPressed(int key) const override { return key >= 0 && key < MAX_KEYS && m_keysPressed[key]; }
+    bool IsMouseButtonDown(int button) const override { return m_source && m_source->IsMouseButtonDown(button); }
+    bool IsMouseButtonPressed(int button) const override {
+        return button >= 0 && button < MAX_MOUSE_BUTTONS && m_buttonsPressed[button];
+    }
+    Vector2 GetMousePosition() const override { return m_source ? m_source->GetMousePosition() : Vector2{0, 0}; }
+
+private:
+    IInputProvider* m_source = nullptr;
+    std::bitset<MAX_KEYS> m_keysPressed;
+    std::bitset<MAX_MOUSE_BUTTONS> m_buttonsPressed;
+};
+
+// ============================================================================
+// Input - Global access point for the active provider
+// ============================================================================
+namespace Input {
+    // Replace the active provider (nullptr restores the raylib provider)
+    void SetProvider(IInputProvider* provider);
+    IInputProvider& GetProvider();
+
+    inline bool IsKeyDown(int key) { return GetProvider().IsKeyDown(key); }
+    inline bool IsKeyPressed(int key) { return GetProvider().IsKeyPressed(key); }
+    inline bool IsMouseButtonDown(int button) { return GetProvider().IsMouseButtonDown(button); }
+    inline bool IsMouseButtonPressed(int button) { return GetProvider().IsMouseButtonPressed(button); }
+    inline Vector2 GetMousePosition() { return GetProvider().GetMousePosition(); }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// Job System - Fork/join parallel loops on a small work-stealing pool
+// ParallelFor cuts [0, count) into fixed-size chunks and deals them out to
+// one queue per thread in contiguous blocks. Each thread drains its own
+// queue from the front and, once it runs dry, steals from the back of the
+// others. The calling thread takes part as thread 0 and returns when every
+// chunk has run. With zero workers the loop runs inline on the caller.
+//
+// Chunk boundaries depend only on count and grain, never on thread timing:
+// give each chunk its own output and merge them in chunk order afterwards to
+// get results that don't change with the worker count.
+// ============================================================================
+class JobSystem {
+public:
+    using RangeFn = std::function<void(int begin, int end, int chunk)>;
+
+    static JobSystem& Instance();
+
+    // Spin up the worker threads (0 = run everything on the caller). Restarts if running.
+    void Start(int workerCount);
+    void Stop();
+    int GetWorkerCount() const { return static_cast<int>(m_workers.size()); }
+
+    static int GetChunkCount(int count, int grainSize);
+
+    // Run fn on every chunk of at most grainSize items and wait for all of
+    // them. Game thread only, not reentrant. Returns the chunk count.
+    int ParallelFor(int count, int grainSize, const RangeFn& fn);
+
+    // Stats
+    int GetStealsLastRun() const { return m_stealsLastRun; }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<int> chunks;
+    };
+
+    JobSystem() = default;
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    void WorkerLoop(int index);
+    bool RunOne(int index);  // Runs a chunk (own queue first, then steals); false if none left
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<Queue>> m_queues;  // One per thread, caller is 0
+
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_workFinished;
+    uint64_t m_generation = 0;  // Bumped per ParallelFor so sleeping workers wake once
+    bool m_stopping = false;
+
+    // Current loop; written before the chunks are queued
+    const RangeFn* m_fn = nullptr;
+    int m_count = 0;
+    int m_grain = 1;
+    std::atomic<int> m_remaining{0};
+    std::atomic<int> m_steals{0};
+    int m_stealsLastRun = 0;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// ============================================================================
+// Mapped File - Read-only memory mapping of a whole file
+// The OS pages data in on first touch and shares it with the file cache, so
+// opening a large file costs a handful of syscalls rather than a full read.
+// Kept free of raylib.h: the Windows mapping API can't share a translation
+// unit with it.
+// ============================================================================
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const { return m_data != nullptr; }
+    const unsigned char* GetData() const { return static_cast<const unsigned char*>(m_data); }
+    size_t GetSize() const { return m_size; }
+
+private:
+    void* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;
+    void* m_mapping = nullptr;
+#endif
+};
@@ -1,13 +1,18 @@
 #pragma once
 
 #include "raylib.h"
+#include <cstdint>
 #include <vector>
 #include <string>
-#include <queue>
+#include <utility>
 #include <unordered_map>
 #include <functional>
 #include <memory>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 class Room;
 
@@ -23,7 +28,7 @@ class Path {
 public:
     std::vector<Vector2> vectorPath;  // World positions to follow
     bool error = false;
-    std::string errorMessage;
+    const char* errorMessage = "";    // Static string, empty on success
     
     bool IsComplete() const { return !error && !vectorPath.empty(); }
     int GetWaypointCount() const { return static_cast<int>(vectorPath.size()); }
@@ -105,18 +110,37 @@ struct PathfinderConfig {
 };
 
 // ============================================================================
-// Pathfinder Node - Internal A* node structure
+// Path Search Context - Scratch state for one A* search at a time
+// Flat arrays indexed by tile (y * Room::WIDTH + x), allocated on first use
+// and invalidated by bumping a generation counter instead of clearing. Each
+// thread that searches needs its own context.
 // ============================================================================
-struct PathNode {
-    int x, y;
-    float gCost;  // Cost from start
-    float hCost;  // Heuristic cost to goal
-    float fCost() const { return gCost + hCost; }
-    int parentX, parentY;
+class PathSearchContext {
+public:
+    PathSearchContext() = default;
+    
+private:
+    friend class Pathfinder;
+    
+    struct SearchNode {
+        float gCost;
+        float fCost;
+        int parent;         // Tile index, -1 for the start
+        int heapIndex;      // Position in m_heap, -1 when not queued
+        uint32_t generation;  // Node is stale unless equal to m_generation
+        bool closed;
+    };
+    
+    void Begin(int nodeCount);  // Size arrays, start a new generation
+    
+    void HeapPush(int node);
+    int HeapPop();
+    void HeapSiftUp(int pos);
+    void HeapSiftDown(int pos);
     
-    bool operator>(const PathNode& other) const {
-        return fCost() > other.fCost();
-    }
+    std::vector<SearchNode> m_nodes;
+    std::vector<int> m_heap;  // Indexed binary min-heap on fCost
+    uint32_t m_generation = 0;
 };
 
 // ============================================================================
@@ -135,6 +159,16 @@ public:
     // Returns a Path object with the result
     Path FindPath(Room* room, Vector2 startWorld, Vector2 goalWorld);
     
+    // Same, but writes into an existing Path so its waypoint storage is
+    // reused. Does not allocate once the search arrays and the path have
+    // warmed up (unless modifiers are installed). Returns !result.error.
+    bool FindPath(Room* room, Vector2 startWorld, Vector2 goalWorld, Path& result);
+    
+    // Bare search with caller-owned scratch state and no modifiers. Safe to
+    // call from several threads at once, each with its own context.
+    bool Search(Room* room, Vector2 startWorld, Vector2 goalWorld, Path& result,
+                PathSearchContext& context) const;
+    
     // Legacy static method for compatibility
     static std::vector<Vector2> FindPathStatic(Room* room, Vector2 startWorld, Vector2 goalWorld);
     
@@ -144,15 +178,136 @@ public:
     // Apply path modifiers
     void AddModifier(std::shared_ptr<PathModifier> modifier);
     void ClearModifiers();
+    void ApplyModifiers(Path& path);
     
 private:
     Pathfinder() = default;
     
     float Heuristic(int x1, int y1, int x2, int y2) const;
-    std::vector<std::pair<int, int>> GetNeighbors(Room* room, int x, int y) const;
     
+    PathSearchContext m_context;  // Game-thread searches
     std::vector<std::shared_ptr<PathModifier>> m_modifiers;
-    DefaultTraversalProvider m_defaultTraversal;
+};
+
+// ============================================================================
+// Path Request Queue - Asynchronous path requests for Seekers
+// Seeker::StartPath submits here; a small worker pool (each worker with its
+// own PathSearchContext) runs the searches, and finished paths are handed
+// back to their Seekers in Update(), the game-thread sync point. With zero
+// workers the searches run inside Update() instead, within the budget.
+// The budget is per rendered frame, refilled by BeginFrame(), so catch-up
+// ticks after a hitch share one frame's worth of searching.
+// ============================================================================
+struct PathQueueBudget {
+    int maxRequestsPerFrame = 24;   // Searches started per frame (<= 0: no cap)
+    float maxMilliseconds = 2.0f;   // Game-thread search time per frame without workers (<= 0: no cap)
+};
+
+class PathRequestQueue {
+public:
+    static PathRequestQueue& Instance();
+    
+    PathQueueBudget budget;
+    
+    // Spin up the worker pool (0 = synchronous mode). Restarts if running.
+    void Start(int workerCount);
+    void Stop();
+    int GetWorkerCount() const { return static_cast<int>(m_workers.size()); }
+    
+    // Refill the budget - call once per rendered frame, before its ticks
+    void BeginFrame();
+    
+    // Sync point - call once per tick on the game thread
+    void Update();
+    
+    // Drop every queued and finished request and wait for in-flight searches
+    // (call before the rooms they reference go away)
+    void CancelAll();
+    
+    // Stats
+    int GetPendingCount();
+    int GetDeliveredLastFrame() const { return m_deliveredLastFrame; }
+    
+private:
+    friend class Seeker;
+    
+    struct Request {
+        uint32_t ticket = 0;
+        Seeker* seeker = nullptr;
+        Room* room = nullptr;
+        Vector2 start = {0, 0};
+        Vector2 end = {0, 0};
+        Path path;
+    };
+    
+    PathRequestQueue() = default;
+    ~PathRequestQueue();
+    
+    uint32_t Submit(Seeker* seeker, Room* room, Vector2 start, Vector2 end);
+    void Cancel(uint32_t ticket);
+    void WorkerLoop(int index);
+    
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<PathSearchContext>> m_contexts;  // One per worker
+    PathSearchContext m_syncContext;                              // Synchronous mode
+    
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_workFinished;
+    std::deque<Request> m_pending;
+    std::vector<Request> m_completed;
+    std::vector<uint32_t> m_inFlight;          // Tickets being searched right now
+    std::vector<uint32_t> m_cancelledInFlight; // ... whose results must be dropped
+    int m_tokens = 0;                          // Searches left in this frame's budget
+    float m_syncMilliseconds = 0.0f;           // Synchronous-mode search time spent this frame
+    bool m_stopping = false;
+    uint32_t m_nextTicket = 1;
+    
+    std::vector<Request> m_delivering;  // Game thread only; Cancel() clears seeker on a match
+    int m_deliveredLastFrame = 0;
+};
+
+// ============================================================================
+// Flow Field - Shared navigation toward a single goal
+// A Dijkstra integration field over the room's tiles plus a direction field
+// (the best neighbor of every tile). Built once per goal tile, after that any
+// number of agents can sample their next step in O(1). Uses the same
+// movement rules and traversal costs as Pathfinder.
+// ============================================================================
+class FlowField {
+public:
+    FlowField() = default;
+    
+    // Rebuild if the goal moved to another tile or the room changed.
+    // Returns true if the field was recomputed.
+    bool Update(Room* room, Vector2 goalWorld);
+    
+    // Drop the cached field (e.g. the room was unloaded)
+    void Invalidate();
+    
+    // Direction to walk from worldPos, toward the next tile center (or the
+    // goal itself inside the goal tile). False if the position is outside the
+    // field or cannot reach the goal.
+    bool SampleDirection(Vector2 worldPos, Vector2& outDir) const;
+    
+    bool IsValid() const { return m_room != nullptr && m_goalReachable; }
+    float GetCost(int x, int y) const;  // Integrated cost to the goal, -1 if unreachable
+    int GetRebuildCount() const { return m_rebuildCount; }
+    
+private:
+    void Build();
+    
+    Room* m_room = nullptr;
+    int m_roomId = -1;
+    int m_goalX = -1;
+    int m_goalY = -1;
+    Vector2 m_goalWorld = {0, 0};
+    bool m_goalReachable = false;
+    int m_rebuildCount = 0;
+    
+    std::vector<float> m_integration;  // Cost to goal per tile (row-major)
+    std::vector<int> m_next;           // Best neighbor tile index, -1 = none
+    std::vector<std::pair<float, int>> m_open;  // Dijkstra min-heap (cost, tile), kept between builds
 };
 
 // ============================================================================
@@ -164,15 +319,34 @@ using OnPathCompleteCallback = std::function<void(const Path&)>;
 class Seeker {
 public:
     Seeker() = default;
+    ~Seeker();
+    
+    // Pending requests point back at the seeker, so it must stay put
+    Seeker(const Seeker&) = delete;
+    Seeker& operator=(const Seeker&) = delete;
     
     // Configuration (similar to AIPath settings)
     float repathRate = 0.3f;              // How often to recalculate paths (seconds)
     float pickNextWaypointDist = 20.0f;   // Distance to pick next waypoint
     bool constrainInsideGraph = true;     // Keep agent on walkable tiles
     
-    // Start a new path request
+    // Hold new requests on the seeker instead of queueing them right away
+    // (the seeker acts as if it had submitted). Lets seekers be driven from
+    // job threads; the owner calls SubmitDeferred() on the game thread, in
+    // the order the queue should see the requests.
+    bool deferSubmit = false;
+    
+    // Start a new path request. The search runs asynchronously; the current
+    // path stays valid until the result is delivered (replacing a request
+    // that is still calculating cancels it).
     void StartPath(Vector2 start, Vector2 end, Room* room, OnPathCompleteCallback callback = nullptr);
     
+    bool HasDeferredRequest() const { return m_submitPending; }
+    void SubmitDeferred();
+    
+    // Drop an outstanding request, if any
+    void CancelPath();
+    
     // Check if the seeker has finished calculating
     bool IsDone() const { return !m_calculating; }
     
@@ -189,15 +363,26 @@ public:
     // Clear the current path
     void ClearPath();
     
+    // Back to a freshly constructed state (configuration kept), for pooled seekers
+    void Reset();
+    
     // Update timer for automatic repathing
     void Update(float dt);
     bool ShouldRepath() const { return m_repathTimer <= 0; }
     void ResetRepathTimer() { m_repathTimer = repathRate; }
     
 private:
+    friend class PathRequestQueue;
+    // Called at the queue's sync point; ignores (and returns false for) a
+    // ticket that isn't the seeker's current request
+    bool OnPathComplete(uint32_t ticket, Path& path);
+    
     Path m_currentPath;
     int m_currentWaypoint = 0;
     bool m_calculating = false;
+    bool m_submitPending = false;  // deferSubmit: request held back, m_start/m_destination describe it
+    uint32_t m_requestTicket = 0;
+    Vector2 m_start = {0, 0};
     float m_repathTimer = 0.0f;
     Vector2 m_destination = {0, 0};
     Room* m_room = nullptr;
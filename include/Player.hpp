@@ -3,6 +3,7 @@
 #include "Entity.hpp"
 #include "Weapon.hpp"
 #include "Ability.hpp"
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <functional>
@@ -103,7 +104,7 @@ public:
     
     // Auto-aim
     Vector2 GetAimDirection() const { return m_aimDirection; }
-    Entity* GetTarget() const { return m_currentTarget; }
+    uint32_t GetTargetId() const { return m_targetId; }  // EnemyManager id, 0 = none
     
     // Respawn
     void Reset();
@@ -132,7 +133,7 @@ private:
     std::unique_ptr<Ability> m_ability;
     
     Vector2 m_aimDirection = {1, 0};
-    Entity* m_currentTarget = nullptr;
+    uint32_t m_targetId = 0;
     
     // Visual
     Color m_color = BLUE;
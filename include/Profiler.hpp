@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Profiler - Scoped CPU timing zones and per-frame counters
+// PROFILE_SCOPE("Name") times the enclosing block; PROFILE_COUNT("Name", n)
+// adds n to a per-frame counter (game thread only). Each thread records zones
+// into its own ring buffer (oldest zones are overwritten), the game thread's
+// zones are summarised once per frame for the overlay, and every buffer can
+// be dumped as a Chrome trace (chrome://tracing, Perfetto).
+//
+// Built with EPITOME_ENABLE_PROFILER (CMake option); without it the macros
+// expand to nothing (their arguments are not evaluated) and the API below
+// reports no data.
+// Zone and counter names must be string literals (only the pointer is stored).
+// ============================================================================
+#if defined(EPITOME_PROFILER) && EPITOME_PROFILER
+    #define PROFILE_CONCAT_INNER(a, b) a##b
+    #define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+    #define PROFILE_SCOPE(name) ::Profiler::Zone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+    #define PROFILE_COUNT(name, value) ::Profiler::Instance().AddCount(name, value)
+#else
+    #define PROFILE_SCOPE(name) ((void)0)
+    #define PROFILE_COUNT(name, value) ((void)0)
+#endif
+
+class Profiler {
+public:
+    static Profiler& Instance();
+
+    static constexpr bool IsCompiledIn() {
+#if defined(EPITOME_PROFILER) && EPITOME_PROFILER
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Zones kept per thread before the oldest are overwritten
+    static constexpr int RING_CAPACITY = 16384;
+
+    // One game-thread zone of the last finished frame (start order)
+    struct ZoneStat {
+        const char* name;
+        int depth;       // Nesting level, 0 = outermost
+        int calls;       // Times entered this frame
+        float ms;        // Total time this frame
+        float avgMs;     // Smoothed over recent frames
+    };
+
+    // Frame boundary, called once per frame by the game thread: summarises
+    // the zones recorded since the previous call
+    void NewFrame();
+
+    // Per-frame counter totals of the last finished frame
+    struct CounterStat {
+        const char* name;
+        long long value;
+    };
+
+    void AddCount(const char* name, long long value);
+
+    const std::vector<ZoneStat>& GetFrameStats() const { return m_frameStats; }
+    const std::vector<CounterStat>& GetFrameCounters() const { return m_frameCounters; }
+    float GetFrameMs() const { return m_frameMs; }
+
+    // Overlay (drawn by UIManager)
+    bool IsOverlayVisible() const { return m_overlayVisible; }
+    void SetOverlayVisible(bool visible) { m_overlayVisible = visible; }
+    void ToggleOverlay() { m_overlayVisible = !m_overlayVisible; }
+
+    // Label the calling thread in traces (string literal)
+    void SetThreadName(const char* name);
+
+    // Write every thread's buffered zones as Chrome trace JSON
+    bool WriteChromeTrace(const char* path);
+
+    // RAII zone, use through PROFILE_SCOPE
+    class Zone {
+    public:
+        explicit Zone(const char* name);
+        ~Zone();
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+    private:
+        const char* m_name;
+        int64_t m_startNs;
+    };
+
+private:
+    Profiler() = default;
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    struct Event {
+        const char* name;
+        int64_t startNs;
+        int64_t endNs;
+        int depth;
+    };
+
+    // Written by its owning thread; the mutex is only contended while the
+    // game thread reads it (NewFrame, WriteChromeTrace)
+    struct ThreadBuffer {
+        std::mutex mutex;
+        std::vector<Event> events;  // Ring, RING_CAPACITY entries
+        size_t head = 0;            // Next slot to write
+        size_t count = 0;           // Valid entries (<= capacity)
+        int depth = 0;              // Open zones (owning thread only)
+        int threadId = 0;
+        const char* name = "Thread";
+    };
+
+    static int64_t NowNs();
+    ThreadBuffer& GetThreadBuffer();
+    void Record(ThreadBuffer& buffer, const char* name, int64_t startNs, int64_t endNs, int depth);
+
+    std::mutex m_registryMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    int64_t m_epochNs = NowNs();
+
+    // Frame summary (game thread)
+    ThreadBuffer* m_frameThread = nullptr;
+    int64_t m_frameStartNs = 0;
+    float m_frameMs = 0.0f;
+    std::vector<Event> m_scratch;
+    std::vector<ZoneStat> m_frameStats;
+    std::vector<ZoneStat> m_averages;  // Persist across frames, keyed by (name, depth)
+    std::vector<CounterStat> m_counters;       // Accumulating for the current frame
+    std::vector<CounterStat> m_frameCounters;
+    bool m_overlayVisible = false;
+};
@@ -1,50 +1,78 @@
 #pragma once
 
-#include "Entity.hpp"
+#include "raylib.h"
+#include "ProjectileRenderer.hpp"
+#include <cstdint>
 #include <vector>
 
-class Projectile : public Entity {
-public:
-    Projectile(Vector2 pos, Vector2 dir, float speed, int damage, 
-               bool playerOwned, bool piercing = false, Color color = WHITE,
-               float size = 6.0f);
-    ~Projectile() override = default;
-    
-    void Update(float dt) override;
-    void Render() override;
-    
-    int GetDamage() const { return m_damage; }
-    bool IsPlayerOwned() const { return m_playerOwned; }
-    bool IsPiercing() const { return m_piercing; }
-    
-    void MarkForDestroy() { m_active = false; }
-    
-private:
-    Vector2 m_direction;
-    float m_speed;
-    int m_damage;
-    bool m_playerOwned;
-    bool m_piercing;
-    Color m_color;
-    float m_lifetime = 3.0f; // auto-destroy after this time
-};
-
+// ============================================================================
+// Projectile Manager - Structure-of-arrays projectile pool
+// Every live projectile is a slot index into parallel arrays. Movement and
+// aging run as one vectorized pass over the hot arrays, dead slots are
+// compacted with swap-remove, so slot order is not stable across Update().
+// ============================================================================
 class ProjectileManager {
 public:
     ProjectileManager() = default;
     ~ProjectileManager() = default;
     
     void Update(float dt);
-    void Render();
+    void Render(Rectangle view);  // Only projectiles overlapping view (world space)
     void Clear();
     
     void SpawnProjectile(Vector2 pos, Vector2 dir, float speed, int damage,
                          bool playerOwned, bool piercing = false, Color color = WHITE,
                          float size = 6.0f);
     
-    // Returns all projectiles for collision checking
-    std::vector<Projectile>& GetProjectiles() { return m_projectiles; }
+    // Slot access for collision checking (0 .. GetCount()-1)
+    int GetCount() const { return static_cast<int>(m_posX.size()); }
+    Vector2 GetPosition(int i) const { return {m_posX[i], m_posY[i]}; }
+    float GetRadius(int i) const { return m_radius[i]; }
+    int GetDamage(int i) const { return m_damage[i]; }
+    bool IsActive(int i) const { return !(m_flags[i] & FLAG_DESTROYED); }
+    bool IsPlayerOwned(int i) const { return m_flags[i] & FLAG_PLAYER_OWNED; }
+    bool IsPiercing(int i) const { return m_flags[i] & FLAG_PIERCING; }
+    
+    void MarkForDestroy(int i) { m_flags[i] |= FLAG_DESTROYED; }
+    
+    // Which integration kernel this build uses ("avx2", "sse2" or "scalar")
+    static const char* GetKernelName();
+    
+    // Draw through the instanced GPU path when the GL version allows it
+    // (one draw call for every projectile); off = queued primitives
+    bool IsInstancingEnabled() const { return m_instancingEnabled; }
+    void SetInstancingEnabled(bool enabled) { m_instancingEnabled = enabled; }
     
 private:
-    std::vector<Projectile> m_projectiles;
+    static constexpr float LIFETIME = 3.0f;  // auto-destroy after this time
+    
+    enum : uint8_t {
+        FLAG_PLAYER_OWNED = 1 << 0,
+        FLAG_PIERCING     = 1 << 1,
+        FLAG_DESTROYED    = 1 << 2,
+    };
+    
+    void Integrate(float dt);
+    void RemoveAt(int i);
+    
+    // Hot (touched every frame by the kernel)
+    std::vector<float> m_posX;
+    std::vector<float> m_posY;
+    std::vector<float> m_prevX;     // Position before the last step (render interpolation)
+    std::vector<float> m_prevY;
+    std::vector<float> m_dirX;
+    std::vector<float> m_dirY;
+    std::vector<float> m_speed;
+    std::vector<float> m_lifetime;
+    
+    // Cold
+    std::vector<float> m_radius;
+    std::vector<int> m_damage;
+    std::vector<uint8_t> m_flags;
+    std::vector<Color> m_color;
+    
+    // Rendering
+    ProjectileRenderer m_instancedRenderer;
+    std::vector<ProjectileRenderer::Instance> m_instances;  // This frame's, drawn at the queue flush
+    bool m_instancingEnabled = true;
 };
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "raylib.h"
+#include <vector>
+
+// ============================================================================
+// Projectile Renderer - Instanced GPU path for projectile bodies and trails
+// The visible projectiles are packed into one per-frame instance buffer
+// (position, direction, radius, color) and drawn with a single instanced
+// call; a small shader cuts each projectile's circle and trail out of its
+// quad. Needs OpenGL 3.3 or ES 3.0: anywhere else, or if the shader doesn't
+// build, Init() fails and ProjectileManager keeps queueing primitives.
+// ============================================================================
+class ProjectileRenderer {
+public:
+    struct Instance {
+        float x, y;          // Interpolated position
+        float dirX, dirY;    // Unit travel direction (trail points the other way)
+        float radius;
+        Color color;
+    };
+    static_assert(sizeof(Instance) == 24, "Instance layout is mirrored by the vertex attributes");
+
+    ProjectileRenderer() = default;
+    ~ProjectileRenderer();
+    ProjectileRenderer(const ProjectileRenderer&) = delete;
+    ProjectileRenderer& operator=(const ProjectileRenderer&) = delete;
+
+    // Create the shader and buffers (main thread, after InitWindow). Only
+    // tries once; returns whether the path is usable.
+    bool Init();
+    void Unload();
+    bool IsReady() const { return m_vao != 0; }
+
+    // Draw every instance in one call (inside BeginMode2D). raylib's own
+    // batch is flushed first so earlier draws stay underneath.
+    void Draw(const std::vector<Instance>& instances);
+
+private:
+    void ReserveInstances(int count);  // Grow the instance buffer (power of two)
+
+    Shader m_shader = {0};
+    int m_mvpLoc = -1;
+    unsigned int m_vao = 0;
+    unsigned int m_quadVbo = 0;
+    unsigned int m_instanceVbo = 0;
+    int m_capacity = 0;                // Instances m_instanceVbo holds
+    bool m_initTried = false;
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// Render Layers - Back to front; everything on a layer draws before the next
+// ============================================================================
+enum class RenderLayer : uint8_t {
+    BODIES,        // Player and enemy bodies
+    PROJECTILES,
+    INDICATORS,    // Stun rings, target markers
+    HEALTH_BARS,
+    COUNT
+};
+
+// ============================================================================
+// Render Queue - Sorted, batched world drawing
+// Systems push compact draw commands during Render(); Flush() sorts them by
+// layer, then texture, then primitive kind, and submits them to raylib. With
+// sprites on shared atlas pages this turns a crowded room into a handful of
+// batches instead of a state change per entity. Within a (layer, texture,
+// kind) group commands keep their push order.
+// ============================================================================
+class RenderQueue {
+public:
+    static RenderQueue& Instance();
+
+    // Textured quad, same parameters as DrawTexturePro
+    void PushSprite(RenderLayer layer, const Texture2D& texture, Rectangle source, Rectangle dest,
+                    Vector2 origin, float rotation, Color tint);
+
+    // Untextured primitives
+    void PushCircle(RenderLayer layer, Vector2 center, float radius, Color color);
+    void PushCircleLines(RenderLayer layer, Vector2 center, float radius, Color color);
+    void PushRect(RenderLayer layer, Rectangle rect, Color color);
+    void PushLine(RenderLayer layer, Vector2 start, Vector2 end, float thickness, Color color);
+    
+    // Custom drawing run at this layer's turn (e.g. an instanced draw that
+    // bypasses raylib's batch); user must stay valid until Flush()
+    void PushCallback(RenderLayer layer, void (*callback)(void* user), void* user);
+
+    // Sort and draw everything pushed since the last flush (inside BeginMode2D)
+    void Flush();
+
+    // Stats of the last flush
+    int GetLastCommandCount() const { return m_lastCommandCount; }
+    int GetLastBatchCount() const { return m_lastBatchCount; }
+
+private:
+    RenderQueue() = default;
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    enum class Kind : uint8_t {
+        SPRITE,
+        RECT,
+        CIRCLE,
+        CIRCLE_LINES,
+        LINE,
+        CALLBACK
+    };
+
+    struct Command {
+        Kind kind;
+        Color color;
+        Texture2D texture;   // SPRITE only
+        Rectangle source;    // SPRITE: source rect
+        Rectangle dest;      // SPRITE/RECT: dest rect; CIRCLE*: x, y, radius; LINE: x0, y0, x1, y1
+        Vector2 origin;      // SPRITE only
+        float param;         // SPRITE: rotation; LINE: thickness
+        uint32_t callback;   // CALLBACK: index into m_callbacks
+    };
+
+    // Layer (8 bits) | texture id (24) | kind (8) | push order (24)
+    static uint64_t MakeKey(RenderLayer layer, unsigned int textureId, Kind kind, uint32_t sequence);
+    void Push(RenderLayer layer, unsigned int textureId, const Command& command);
+
+    std::vector<Command> m_commands;
+    std::vector<std::pair<void (*)(void*), void*>> m_callbacks;
+    std::vector<std::pair<uint64_t, uint32_t>> m_keys;  // Sort key, command index
+    int m_lastCommandCount = 0;
+    int m_lastBatchCount = 0;
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "raylib.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// ============================================================================
+// Spatial Grid - Uniform spatial hash used as a collision broadphase
+// Entities are binned by the cell containing their center; queries widen the
+// search area by the largest inserted radius. Rebuilt from scratch every frame
+// (Clear/Insert/Build), storage is reused so steady-state rebuilds don't
+// allocate.
+// ============================================================================
+class SpatialGrid {
+public:
+    explicit SpatialGrid(float cellSize, int bucketCount = 4096);
+
+    // Rebuild
+    void Clear();
+    void Insert(int id, Vector2 pos, float radius);
+    void Build();  // Must be called after the last Insert, before queries
+
+    // Visit the id of every entity whose cell overlaps the circle's bounds
+    // (candidates only - callers do the exact test). Each id is reported once
+    // unless the query spans more than 16 cells and two of them share a bucket.
+    // fn may return bool: false ends the query (to cap work in dense spots).
+    // Such queries visit cells in rings outward from the one holding center,
+    // so one cut short has seen the closest entities, not the top-left ones.
+    template <typename Fn>
+    void ForEachCandidate(Vector2 center, float radius, Fn&& fn) const;
+    
+    // Replace out with the ids of every entity whose cell overlaps the
+    // rectangle (widened by the largest radius), ascending and each once.
+    // Meant for big areas like the camera view; candidates only.
+    void CollectInRect(Rectangle rect, std::vector<int>& out) const;
+
+    float GetCellSize() const { return m_cellSize; }
+    int GetCount() const { return static_cast<int>(m_items.size()); }
+    float GetMaxRadius() const { return m_maxRadius; }
+
+private:
+    struct Item {
+        int id;
+        uint32_t bucket;
+    };
+
+    int CellCoord(float v) const { return static_cast<int>(std::floor(v * m_invCellSize)); }
+    uint32_t Bucket(int cx, int cy) const {
+        uint32_t h = static_cast<uint32_t>(cx) * 73856093u ^ static_cast<uint32_t>(cy) * 19349663u;
+        return h & m_bucketMask;
+    }
+
+    float m_cellSize;
+    float m_invCellSize;
+    uint32_t m_bucketMask;
+    float m_maxRadius = 0.0f;
+
+    std::vector<Item> m_items;          // Insert order
+    std::vector<uint32_t> m_bucketStart; // Prefix sums, size bucketCount + 1
+    std::vector<int> m_sortedIds;        // Ids grouped by bucket
+};
+
+template <typename Fn>
+void SpatialGrid::ForEachCandidate(Vector2 center, float radius, Fn&& fn) const {
+    if (m_sortedIds.empty()) return;
+
+    float reach = radius + m_maxRadius;
+    int minX = CellCoord(center.x - reach);
+    int maxX = CellCoord(center.x + reach);
+    int minY = CellCoord(center.y - reach);
+    int maxY = CellCoord(center.y + reach);
+
+    // Cells that hash to the same bucket would report the bucket twice,
+    // visit each distinct bucket once (queries only span a handful of cells)
+    constexpr int MAX_TRACKED = 16;
+    uint32_t visited[MAX_TRACKED];
+    int visitedCount = 0;
+
+    constexpr bool canStop = std::is_same_v<std::invoke_result_t<Fn&, int>, bool>;
+
+    // False once fn asked to stop
+    auto visitCell = [&](int cx, int cy) {
+        uint32_t bucket = Bucket(cx, cy);
+
+        for (int i = 0; i < visitedCount; ++i) {
+            if (visited[i] == bucket) return true;
+        }
+        if (visitedCount < MAX_TRACKED) visited[visitedCount++] = bucket;
+
+        for (uint32_t i = m_bucketStart[bucket]; i < m_bucketStart[bucket + 1]; ++i) {
+            if constexpr (canStop) {
+                if (!fn(m_sortedIds[i])) return false;
+            } else {
+                fn(m_sortedIds[i]);
+            }
+        }
+        return true;
+    };
+
+    if constexpr (!canStop) {
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cx = minX; cx <= maxX; ++cx) {
+                visitCell(cx, cy);
+            }
+        }
+        return;
+    }
+
+    // Ring r is the cells r steps from the center cell: whole top and bottom
+    // rows, only the two end cells of the rows between
+    const int centerX = CellCoord(center.x);
+    const int centerY = CellCoord(center.y);
+    const int rings = std::max({centerX - minX, maxX - centerX, centerY - minY, maxY - centerY});
+    for (int ring = 0; ring <= rings; ++ring) {
+        for (int cy = std::max(minY, centerY - ring); cy <= std::min(maxY, centerY + ring); ++cy) {
+            bool fullRow = cy == centerY - ring || cy == centerY + ring;
+            int step = fullRow ? 1 : 2 * ring;
+            for (int cx = centerX - ring; cx <= centerX + ring; cx += step) {
+                if (cx < minX || cx > maxX) continue;
+                if (!visitCell(cx, cy)) return;
+            }
+        }
+    }
+}
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "raylib.h"
+#include "TextureAtlas.hpp"
+#include "RenderQueue.hpp"
+#include <array>
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <memory>
+#include <optional>
 #include <vector>
 
 // ============================================================================
@@ -60,10 +64,16 @@ struct AnimationData {
 
 // ============================================================================
 // Sprite Data - Contains texture and rendering info
+// Sprites loaded through LoadFromDirectory live on a shared atlas page;
+// region is where this sprite's image sits within texture.
 // ============================================================================
 struct SpriteData {
     Texture2D texture = {0};
     bool isLoaded = false;
+    bool ownsTexture = false;    // False for atlas pages (the atlas unloads them)
+    
+    // Sprite's image within texture (whole texture when not atlased)
+    Rectangle region = {0, 0, 0, 0};
     
     // Source rectangle (for sprite sheets)
     Rectangle sourceRect = {0, 0, 0, 0};
@@ -94,10 +104,22 @@ public:
     static SpriteManager& Instance();
     
     // Initialization and cleanup
-    void Init();
+    void Init();  // Starts streaming the asset directory, returns right away
     void Shutdown();
     void Update(float dt);  // Update animations
     
+    // Background loading: files are found and decoded on worker threads and
+    // packed into atlas pages there; the main thread then uploads a few
+    // textures per UpdateStreaming() call. A sprite shows up as soon as its
+    // texture lands - until then HasSprite() is false and callers draw their
+    // primitive fallback. With a packPath that opens (see AssetPack.hpp) the
+    // pack's pre-decoded images are used instead of the directory's PNGs.
+    void BeginStreaming(const std::string& directory, const std::string& packPath = "");
+    void UpdateStreaming(int maxUploads = MAX_UPLOADS_PER_FRAME);  // Main thread, once per frame
+    int FinishStreaming();  // Block until everything is uploaded; returns sprites loaded
+    bool IsStreaming() const { return m_stream != nullptr; }
+    static constexpr int MAX_UPLOADS_PER_FRAME = 2;
+    
     // Load sprites from files
     bool LoadSprite(SpriteType type, const std::string& filename);
     bool LoadAnimatedSprite(SpriteType type, const std::string& filename, 
@@ -107,12 +129,16 @@ public:
     // Unload specific sprite
     void UnloadSprite(SpriteType type);
     
-    // Check if sprite is loaded
-    bool HasSprite(SpriteType type) const;
+    // Check if sprite is loaded (one bit test, called per entity per frame)
+    bool HasSprite(SpriteType type) const { return (m_loadedMask & Bit(type)) != 0; }
     
-    // Get sprite data for custom rendering
-    SpriteData* GetSprite(SpriteType type);
-    const SpriteData* GetSprite(SpriteType type) const;
+    // Get sprite data for custom rendering (nullptr if not loaded)
+    SpriteData* GetSprite(SpriteType type) {
+        return HasSprite(type) ? &m_sprites[static_cast<int>(type)] : nullptr;
+    }
+    const SpriteData* GetSprite(SpriteType type) const {
+        return HasSprite(type) ? &m_sprites[static_cast<int>(type)] : nullptr;
+    }
     
     // ========================================================================
     // Rendering helpers - Draw sprites easily
@@ -134,6 +160,10 @@ public:
     void DrawFitRadius(SpriteType type, Vector2 position, float radius);
     void DrawFitRadius(SpriteType type, Vector2 position, float radius, float rotation, Color tint);
     
+    // Same as DrawFitRadius, but pushed to the RenderQueue for batching
+    void QueueFitRadius(RenderLayer layer, SpriteType type, Vector2 position, float radius, 
+                        float rotation, Color tint);
+    
     // Draw stretched to fill a rectangle
     void DrawRect(SpriteType type, Rectangle destRect);
     void DrawRect(SpriteType type, Rectangle destRect, Color tint);
@@ -146,13 +176,21 @@ public:
     void SetAssetPath(const std::string& path) { m_assetPath = path; }
     std::string GetAssetPath() const { return m_assetPath; }
     
+    // Baked pack tried before the loose files at Init (built by EpitomePacker)
+    void SetPackPath(const std::string& path) { m_packPath = path; }
+    std::string GetPackPath() const { return m_packPath; }
+    
     // Sprite configuration helpers
     void SetSpriteScale(SpriteType type, float scale);
     void SetSpriteOrigin(SpriteType type, Vector2 origin);
     void SetSpriteTint(SpriteType type, Color tint);
     
-    // Load all sprites from a config (returns number loaded)
+    // Load all sprites from a config (returns number loaded). Images are
+    // packed into shared atlas pages so entity sprites draw without texture
+    // switches; anything too big for a page gets its own texture.
+    // Synchronous: the same pipeline as BeginStreaming, waited on.
     int LoadFromDirectory(const std::string& directory);
+    int GetAtlasPageCount() const { return m_atlas.GetPageCount(); }
     
     // ========================================================================
     // Utility
@@ -165,18 +203,41 @@ public:
     static std::string GetDefaultFilename(SpriteType type);
     
 private:
-    SpriteManager() = default;
-    ~SpriteManager() = default;
+    SpriteManager();
+    ~SpriteManager();
     SpriteManager(const SpriteManager&) = delete;
     SpriteManager& operator=(const SpriteManager&) = delete;
     
-    std::unordered_map<SpriteType, SpriteData> m_sprites;
+    static constexpr int SPRITE_COUNT = static_cast<int>(SpriteType::COUNT);
+    static_assert(SPRITE_COUNT <= 32, "Sprite masks are 32-bit");
+    static constexpr uint32_t Bit(SpriteType type) { return 1u << static_cast<int>(type); }
+    
+    // Dense storage indexed by SpriteType; a slot is live when its bit is set
+    std::array<SpriteData, SPRITE_COUNT> m_sprites = {};
+    uint32_t m_loadedMask = 0;
+    uint32_t m_animatedMask = 0;  // Subset of m_loadedMask that Update() advances
+    TextureAtlas m_atlas;
+    
+    struct StreamJob;
+    std::unique_ptr<StreamJob> m_stream;  // In-flight BeginStreaming, null when idle
+    static void RunStreamJob(StreamJob& job, TextureAtlas& atlas);  // Loader thread
+    static void DecodeDirectory(StreamJob& job);                     // Loose PNGs, on a small pool
+    bool DrainUploads(int maxUploads);    // True once the job is fully uploaded
+    void CompleteStreaming();             // Join the loader, log, drop the job
     std::string m_assetPath = "assets/sprites/";
+    std::string m_packPath = "assets/sprites.pak";
     bool m_initialized = false;
+    unsigned int m_lastTextureId = 0;  // For the texture switch counter
     
     // Internal helpers
+    void StoreSprite(SpriteType type, const SpriteData& sprite);
+    void ReleaseSprite(SpriteType type);
+    void SubmitDraw(const SpriteData& sprite, Rectangle srcRect, Rectangle destRect,
+                    Vector2 origin, float rotation, Color tint, std::optional<RenderLayer> layer);
     void DrawInternal(const SpriteData& sprite, Vector2 position, 
-                      float rotation, float scale, Color tint);
+                      float rotation, float scale, Color tint,
+                      std::optional<RenderLayer> layer = std::nullopt);  // nullopt = draw now
+    static float FitRadiusScale(const SpriteData& sprite, float radius);
 };
 
 // ============================================================================
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// Text Cache - Memoized measuring and glyph layout for the default font
+// MeasureText/DrawText decode the UTF-8, look up every glyph and lay the
+// string out again on each call, though UI labels almost never change. The
+// cache keeps each (text, size) pair's width and glyph quads, so drawing a
+// cached string is just its quads. Changed text is simply a new key; entries
+// that go undrawn for EVICT_AFTER_FRAMES frames are dropped.
+// Results match raylib's DrawText/MeasureText (same size and spacing rules).
+// ============================================================================
+class TextCache {
+public:
+    static TextCache& Instance();
+
+    int Measure(const char* text, int fontSize);
+    void Draw(const char* text, int x, int y, int fontSize, Color color);
+
+    // Frame boundary: ages entries, sweeping stale ones now and then
+    void NewFrame();
+    void Clear();
+
+    // Off = straight raylib calls (for comparing in the profiler)
+    bool IsEnabled() const { return m_enabled; }
+    void SetEnabled(bool enabled);
+
+    int GetEntryCount() const;
+
+    static constexpr uint32_t EVICT_AFTER_FRAMES = 300;
+    static constexpr uint32_t SWEEP_INTERVAL = 60;
+
+private:
+    TextCache() = default;
+    TextCache(const TextCache&) = delete;
+    TextCache& operator=(const TextCache&) = delete;
+
+    struct Glyph {
+        Rectangle source;   // In the font texture
+        Rectangle dest;     // Relative to the draw position
+    };
+
+    struct Entry {
+        int width = 0;
+        std::vector<Glyph> glyphs;
+        uint32_t lastUsed = 0;
+    };
+
+    // Transparent so lookups by const char* don't build a std::string
+    struct Hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view text) const { return std::hash<std::string_view>{}(text); }
+    };
+    using SizeMap = std::unordered_map<std::string, Entry, Hash, std::equal_to<>>;
+
+    // nullptr while the default font isn't loaded (no window yet)
+    const Entry* Get(const char* text, int fontSize);
+    static Entry Layout(const Font& font, const char* text, int fontSize);
+
+    std::vector<std::pair<int, SizeMap>> m_sizes;  // A handful of sizes, scanned linearly
+    Texture2D m_fontTexture = {0};
+    uint32_t m_frame = 0;
+    bool m_enabled = true;
+};
+
+// ============================================================================
+// Drop-in replacements for MeasureText/DrawText that go through the cache
+// ============================================================================
+namespace Text {
+    inline int Measure(const char* text, int fontSize) {
+        return TextCache::Instance().Measure(text, fontSize);
+    }
+
+    inline void Draw(const char* text, int x, int y, int fontSize, Color color) {
+        TextCache::Instance().Draw(text, x, y, fontSize, color);
+    }
+}
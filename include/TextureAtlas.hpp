@@ -0,0 +1,82 @@
+#pragma once
+
+#include "raylib.h"
+#include <vector>
+
+// ============================================================================
+// Skyline Packer - Places rectangles into a fixed-size page
+// Keeps the top edge of the packed area as a list of horizontal segments and
+// puts each rectangle where its top ends lowest (ties: narrowest fit). Good
+// packing for sprite-sized inputs, O(segments) per insert.
+// ============================================================================
+class SkylinePacker {
+public:
+    SkylinePacker(int width, int height);
+
+    // Find a spot for a w x h rectangle; false if the page is full
+    bool Insert(int w, int h, int& outX, int& outY);
+
+    int GetWidth() const { return m_width; }
+    int GetHeight() const { return m_height; }
+    int GetUsedHeight() const;
+
+private:
+    struct Segment {
+        int x;
+        int y;      // Top of the packed area over [x, x + width)
+        int width;
+    };
+
+    // Lowest y a w x h rectangle can sit at when its left edge is at segment
+    // index; -1 if it doesn't fit there
+    int FitAt(int index, int w, int h) const;
+
+    int m_width;
+    int m_height;
+    std::vector<Segment> m_skyline;
+};
+
+// ============================================================================
+// Texture Atlas - Packs many images into a few shared texture pages
+// Sprites that share a page share a texture, so raylib's batcher can draw
+// them back to back without a texture switch.
+// Building is two stages: Compose() packs and fills page images on the CPU
+// (safe off the main thread), UploadNextPage() turns one page into a texture
+// (main thread, needs the GL context).
+// ============================================================================
+class TextureAtlas {
+public:
+    struct Region {
+        int page = -1;                  // -1 = not packed
+        Rectangle rect = {0, 0, 0, 0};  // Pixels within the page
+    };
+
+    TextureAtlas() = default;
+    ~TextureAtlas();
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    // Pack the images into page images (nothing is uploaded yet). The atlas
+    // must be empty: Unload() any previous build first, on the main thread.
+    // One region per input image; images too big for a page are left
+    // unpacked (page -1) for the caller to load on their own.
+    std::vector<Region> Compose(const std::vector<Image>& images);
+
+    // Upload the next composed page; returns its index, or -1 if none is left
+    int UploadNextPage();
+
+    // Compose and upload everything at once
+    std::vector<Region> Build(const std::vector<Image>& images);
+    void Unload();
+
+    int GetPageCount() const { return static_cast<int>(m_pageImages.size()); }
+    bool IsPageUploaded(int index) const { return index < static_cast<int>(m_pages.size()); }
+    const Texture2D& GetPage(int index) const { return m_pages[index]; }
+
+    static constexpr int MAX_PAGE_SIZE = 2048;
+    static constexpr int PADDING = 2;  // Transparent gutter so filtering can't bleed neighbours
+
+private:
+    std::vector<Image> m_pageImages;  // CPU copies until uploaded (then freed)
+    std::vector<Texture2D> m_pages;   // Uploaded pages, in page order
+};
@@ -34,6 +34,7 @@ public:
     
     // Debug menu
     void RenderDebugMenu();
+    void RenderProfilerOverlay();
     
     // Helpers
     static void DrawHealthBar(Vector2 pos, float width, float height, 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstdint>
+#include <vector>
+
+class Room;
+
+// ============================================================================
+// Visibility Table - Precomputed tile-to-tile line of sight for one room
+// One bit per (from, to) tile pair, 165x165 bits for a 15x11 room. A pair is
+// visible when the segment between the two tile centers only crosses
+// walkable tiles. Built by Room::Generate, dropped when a tile changes.
+// ============================================================================
+class VisibilityTable {
+public:
+    void Build(const Room& room);
+    void Clear() { m_bits.clear(); }
+    bool IsBuilt() const { return !m_bits.empty(); }
+    
+    // Tile indices are y * Room::WIDTH + x
+    bool IsVisible(int fromTile, int toTile) const {
+        uint32_t bit = static_cast<uint32_t>(fromTile * m_tileCount + toTile);
+        return (m_bits[bit >> 6] >> (bit & 63)) & 1u;
+    }
+    
+private:
+    int m_tileCount = 0;
+    std::vector<uint64_t> m_bits;
+};
+
+// ============================================================================
+// Visibility - Line-of-sight queries against a room's tiles
+// Raycast is exact: it walks every tile the segment touches (Amanatides-Woo
+// grid traversal), and a segment passing exactly through a corner is blocked
+// if either side tile is. HasLineOfSight answers from the room's table when
+// it has one (tile-center granularity), otherwise it raycasts.
+// ============================================================================
+namespace Visibility {
+    // True if nothing blocks the segment between two world positions
+    bool Raycast(const Room& room, Vector2 from, Vector2 to);
+    
+    // Same between two tile centers
+    bool Raycast(const Room& room, int fromX, int fromY, int toX, int toY);
+    
+    // Table lookup when available, exact raycast otherwise
+    bool HasLineOfSight(const Room& room, Vector2 from, Vector2 to);
+}
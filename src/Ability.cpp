@@ -3,6 +3,7 @@
 #include "Game.hpp"
 #include "Dungeon.hpp"
 #include "Enemy.hpp"
+#include "Visibility.hpp"
 #include "Utils.hpp"
 
 Ability::Ability(const std::string& name, float cooldown, int energyCost,
@@ -56,16 +57,20 @@ namespace Abilities {
                 Vector2 dashOffset = Vector2Scale(dashDir, 150.0f);
                 Vector2 newPos = Vector2Add(player->GetPosition(), dashOffset);
                 
-                // Check if we can dash there (simplified - just check endpoint)
+                // Check if we can dash there - the whole dash line must be
+                // clear, so no dashing through pillars
                 DungeonManager* dungeon = Game::Instance().GetDungeon();
-                if (dungeon && dungeon->IsWalkable(newPos)) {
+                Room* room = dungeon ? dungeon->GetCurrentRoom() : nullptr;
+                if (!room) return;
+                
+                if (Visibility::Raycast(*room, player->GetPosition(), newPos)) {
                     player->SetPosition(newPos);
                 } else {
                     // Try partial dash
                     for (float t = 0.9f; t > 0.1f; t -= 0.1f) {
                         Vector2 testPos = Vector2Add(player->GetPosition(), 
                             Vector2Scale(dashOffset, t));
-                        if (dungeon->IsWalkable(testPos)) {
+                        if (Visibility::Raycast(*room, player->GetPosition(), testPos)) {
                             player->SetPosition(testPos);
                             break;
                         }
@@ -92,13 +97,13 @@ namespace Abilities {
                 float burstRadius = 120.0f;
                 int burstDamage = 30;
                 
-                for (auto& enemy : enemies->GetEnemies()) {
-                    if (!enemy || enemy->IsDead()) continue;
+                for (int i = 0; i < enemies->GetCount(); ++i) {
+                    if (enemies->IsDead(i)) continue;
                     
                     float dist = Vector2Distance(player->GetPosition(), 
-                                                  enemy->GetPosition());
+                                                  enemies->GetPosition(i));
                     if (dist <= burstRadius) {
-                        enemy->TakeDamage(burstDamage);
+                        enemies->TakeDamage(i, burstDamage);
                     }
                 }
                 
@@ -122,13 +127,13 @@ namespace Abilities {
                 float explosionRadius = 100.0f;
                 int explosionDamage = 50;
                 
-                for (auto& enemy : enemies->GetEnemies()) {
-                    if (!enemy || enemy->IsDead()) continue;
+                for (int i = 0; i < enemies->GetCount(); ++i) {
+                    if (enemies->IsDead(i)) continue;
                     
                     float dist = Vector2Distance(player->GetPosition(), 
-                                                  enemy->GetPosition());
+                                                  enemies->GetPosition(i));
                     if (dist <= explosionRadius) {
-                        enemy->TakeDamage(explosionDamage);
+                        enemies->TakeDamage(i, explosionDamage);
                     }
                 }
                 
@@ -152,13 +157,13 @@ namespace Abilities {
                 float flashRadius = 150.0f;
                 float stunDuration = 3.0f;
                 
-                for (auto& enemy : enemies->GetEnemies()) {
-                    if (!enemy || enemy->IsDead()) continue;
+                for (int i = 0; i < enemies->GetCount(); ++i) {
+                    if (enemies->IsDead(i)) continue;
                     
                     float dist = Vector2Distance(player->GetPosition(), 
-                                                  enemy->GetPosition());
+                                                  enemies->GetPosition(i));
                     if (dist <= flashRadius) {
-                        enemy->Immobilize(stunDuration);
+                        enemies->Immobilize(i, stunDuration);
                     }
                 }
                 
@@ -0,0 +1,147 @@
+#include "AssetPack.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+// ============================================================================
+// Writer
+// ============================================================================
+bool AssetPack::Write(const std::string& path, const std::vector<Source>& sources) {
+    std::vector<const Source*> sorted;
+    for (const Source& source : sources) {
+        if (source.name.size() >= NAME_LENGTH) {
+            TraceLog(LOG_WARNING, "AssetPack: Name too long for a pack entry: %s", source.name.c_str());
+            return false;
+        }
+        sorted.push_back(&source);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Source* a, const Source* b) { return a->name < b->name; });
+
+    auto align = [](uint64_t value) {
+        return (value + PAYLOAD_ALIGNMENT - 1) / PAYLOAD_ALIGNMENT * PAYLOAD_ALIGNMENT;
+    };
+
+    // Everything is converted up front so the directory knows every size
+    std::vector<Image> pixels;
+    std::vector<Entry> entries(sorted.size());
+    uint64_t offset = align(sizeof(Header) + sizeof(Entry) * sorted.size());
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        Image image = ImageCopy(sorted[i]->image);
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        pixels.push_back(image);
+
+        Entry& entry = entries[i];
+        memset(&entry, 0, sizeof(entry));
+        memcpy(entry.name, sorted[i]->name.c_str(), sorted[i]->name.size());
+        entry.width = image.width;
+        entry.height = image.height;
+        entry.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        entry.compression = Compression::NONE;
+        entry.offset = offset;
+        entry.size = static_cast<uint64_t>(image.width) * image.height * 4;
+        offset = align(offset + entry.size);
+    }
+
+    Header header = {MAGIC, VERSION, static_cast<uint32_t>(entries.size()), 0};
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    bool ok = static_cast<bool>(file);
+    if (ok) {
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()), sizeof(Entry) * entries.size());
+
+        static const char zeros[PAYLOAD_ALIGNMENT] = {};
+        for (size_t i = 0; i < entries.size(); ++i) {
+            uint64_t position = static_cast<uint64_t>(file.tellp());
+            file.write(zeros, static_cast<std::streamsize>(entries[i].offset - position));
+            file.write(static_cast<const char*>(pixels[i].data), static_cast<std::streamsize>(entries[i].size));
+        }
+        ok = static_cast<bool>(file);
+    }
+
+    for (Image& image : pixels) {
+        UnloadImage(image);
+    }
+    if (!ok) {
+        TraceLog(LOG_WARNING, "AssetPack: Failed to write %s", path.c_str());
+    }
+    return ok;
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+bool AssetPackReader::Open(const std::string& path) {
+    Close();
+    if (!m_file.Open(path)) return false;
+
+    const unsigned char* data = m_file.GetData();
+    const size_t size = m_file.GetSize();
+
+    AssetPack::Header header;
+    if (size < sizeof(header)) {
+        TraceLog(LOG_WARNING, "AssetPack: %s is too small to be a pack", path.c_str());
+        Close();
+        return false;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != AssetPack::MAGIC || header.version != AssetPack::VERSION) {
+        TraceLog(LOG_WARNING, "AssetPack: %s is not a version %u pack", path.c_str(), AssetPack::VERSION);
+        Close();
+        return false;
+    }
+    if (header.entryCount > (size - sizeof(header)) / sizeof(AssetPack::Entry)) {
+        TraceLog(LOG_WARNING, "AssetPack: %s directory is truncated", path.c_str());
+        Close();
+        return false;
+    }
+
+    m_entries.resize(header.entryCount);
+    memcpy(m_entries.data(), data + sizeof(header), sizeof(AssetPack::Entry) * header.entryCount);
+
+    // Check every entry once here so lookups can trust them
+    for (AssetPack::Entry& entry : m_entries) {
+        entry.name[AssetPack::NAME_LENGTH - 1] = '\0';
+        uint64_t expected = static_cast<uint64_t>(std::max(entry.width, 0)) * std::max(entry.height, 0) * 4;
+        bool valid = entry.compression == AssetPack::Compression::NONE &&
+                     entry.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 &&
+                     entry.width > 0 && entry.height > 0 && entry.size == expected &&
+                     entry.offset % AssetPack::PAYLOAD_ALIGNMENT == 0 &&
+                     entry.offset <= size && entry.size <= size - entry.offset;
+        if (!valid) {
+            TraceLog(LOG_WARNING, "AssetPack: %s has a bad entry (%s)", path.c_str(), entry.name);
+            Close();
+            return false;
+        }
+    }
+    if (!std::is_sorted(m_entries.begin(), m_entries.end(), [](const AssetPack::Entry& a, const AssetPack::Entry& b) {
+            return strcmp(a.name, b.name) < 0; })) {
+        TraceLog(LOG_WARNING, "AssetPack: %s directory is not sorted", path.c_str());
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void AssetPackReader::Close() {
+    m_file.Close();
+    m_entries.clear();
+}
+
+const AssetPack::Entry* AssetPackReader::Find(const char* name) const {
+    auto it = std::lower_bound(m_entries.begin(), m_entries.end(), name,
+        [](const AssetPack::Entry& entry, const char* key) { return strcmp(entry.name, key) < 0; });
+    if (it == m_entries.end() || strcmp(it->name, name) != 0) return nullptr;
+    return &*it;
+}
+
+Image AssetPackReader::GetImage(const AssetPack::Entry& entry) const {
+    Image image = {0};
+    // raylib takes a mutable pointer but only reads it when uploading
+    image.data = const_cast<unsigned char*>(m_file.GetData() + entry.offset);
+    image.width = entry.width;
+    image.height = entry.height;
+    image.mipmaps = 1;
+    image.format = entry.format;
+    return image;
+}
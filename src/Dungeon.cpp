@@ -3,13 +3,20 @@
 #include "Game.hpp"
 #include "Player.hpp"
 #include "SpriteManager.hpp"
+#include "Pathfinding.hpp"
+#include "Profiler.hpp"
+#include "TextCache.hpp"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
 
 // Room implementation
 Room::Room(int id, RoomType type, int gridX, int gridY)
     : m_id(id), m_type(type), m_gridX(gridX), m_gridY(gridY)
 {
     // Initialize tile grid
-    m_tiles.resize(HEIGHT, std::vector<TileType>(WIDTH, TileType::FLOOR));
+    m_tiles.fill(static_cast<uint8_t>(TileType::FLOOR));
+    RebuildWalkability();
 }
 
 void Room::Generate(unsigned int seed) {
@@ -19,9 +26,9 @@ void Room::Generate(unsigned int seed) {
     for (int y = 0; y < HEIGHT; ++y) {
         for (int x = 0; x < WIDTH; ++x) {
             if (x == 0 || x == WIDTH - 1 || y == 0 || y == HEIGHT - 1) {
-                m_tiles[y][x] = TileType::WALL;
+                m_tiles[y * WIDTH + x] = static_cast<uint8_t>(TileType::WALL);
             } else {
-                m_tiles[y][x] = TileType::FLOOR;
+                m_tiles[y * WIDTH + x] = static_cast<uint8_t>(TileType::FLOOR);
             }
         }
     }
@@ -34,7 +41,7 @@ void Room::Generate(unsigned int seed) {
             int y = Utils::RandomInt(3, HEIGHT - 4);
             
             // Small pillar or obstacle
-            m_tiles[y][x] = TileType::WALL;
+            m_tiles[y * WIDTH + x] = static_cast<uint8_t>(TileType::WALL);
         }
     }
     
@@ -61,10 +68,14 @@ void Room::Generate(unsigned int seed) {
             default:
                 continue;
         }
-        m_tiles[doorY][doorX] = TileType::DOOR;
+        m_tiles[doorY * WIDTH + doorX] = static_cast<uint8_t>(TileType::DOOR);
         door.position = TileToWorld(doorX, doorY);
     }
     
+    RebuildWalkability();
+    m_visibility.Build(*this);
+    ++m_tileRevision;
+    
     // Set player spawn point (center of room for start room)
     m_playerSpawn = TileToWorld(WIDTH / 2, HEIGHT / 2);
     
@@ -138,16 +149,88 @@ void Room::Generate(unsigned int seed) {
         for (int i = 0; i < numSpawns; ++i) {
             int x = Utils::RandomInt(2, WIDTH - 3);
             int y = Utils::RandomInt(2, HEIGHT - 3);
-            if (m_tiles[y][x] == TileType::FLOOR) {
+            if (GetTile(x, y) == TileType::FLOOR) {
                 m_enemySpawns.push_back(TileToWorld(x, y));
             }
         }
     }
 }
 
-void Room::Render(Vector2 offset) {
-    for (int y = 0; y < HEIGHT; ++y) {
-        for (int x = 0; x < WIDTH; ++x) {
+Room::~Room() {
+    ReleaseTileCache();
+}
+
+void Room::Render(Vector2 offset, Rectangle view) {
+    PROFILE_SCOPE("Room::Render");
+    
+    if (m_bakedRevision == m_tileRevision) {
+        // Only the visible part of the baked layer
+        Vector2 roomPos = GetWorldPosition();
+        Rectangle bounds = {roomPos.x + offset.x, roomPos.y + offset.y,
+                            static_cast<float>(WIDTH * TILE_SIZE), static_cast<float>(HEIGHT * TILE_SIZE)};
+        Rectangle visible = GetCollisionRec(bounds, view);
+        if (visible.width > 0.0f && visible.height > 0.0f) {
+            // Render textures are stored flipped: room row v sits at texture row (height - v)
+            float top = visible.y - bounds.y;
+            Rectangle source = {visible.x - bounds.x, bounds.height - top - visible.height,
+                                visible.width, -visible.height};
+            DrawTextureRec(m_tileCache.texture, source, {visible.x, visible.y}, WHITE);
+            PROFILE_COUNT("Room tile draw calls", 1);
+        }
+    } else {
+        int drawCalls = RenderTiles(offset, view);
+        PROFILE_COUNT("Room tile draw calls", drawCalls);
+    }
+    
+    RenderProps(offset);
+}
+
+void Room::UpdateTileCache() {
+    if (m_bakedRevision == m_tileRevision) return;
+    
+    if (m_tileCache.id == 0) {
+        m_tileCache = LoadRenderTexture(WIDTH * TILE_SIZE, HEIGHT * TILE_SIZE);
+        if (m_tileCache.id == 0) return;  // Keep drawing tiles directly
+    }
+    
+    // Map the room's world rectangle onto the texture
+    Camera2D camera = {0};
+    camera.target = GetWorldPosition();
+    camera.zoom = 1.0f;
+    
+    BeginTextureMode(m_tileCache);
+    ClearBackground(BLANK);
+    BeginMode2D(camera);
+    Vector2 roomPos = GetWorldPosition();
+    RenderTiles({0, 0}, {roomPos.x, roomPos.y, static_cast<float>(WIDTH * TILE_SIZE),
+                         static_cast<float>(HEIGHT * TILE_SIZE)});
+    EndMode2D();
+    EndTextureMode();
+    
+    m_bakedRevision = m_tileRevision;
+}
+
+void Room::ReleaseTileCache() {
+    if (m_tileCache.id != 0) {
+        UnloadRenderTexture(m_tileCache);
+        m_tileCache = {0};
+    }
+    m_bakedRevision = 0;
+}
+
+int Room::RenderTiles(Vector2 offset, Rectangle view) const {
+    // Tile columns and rows overlapping the view
+    Vector2 roomPos = GetWorldPosition();
+    float localX = view.x - roomPos.x - offset.x;
+    float localY = view.y - roomPos.y - offset.y;
+    int minX = std::max(static_cast<int>(std::floor(localX / TILE_SIZE)), 0);
+    int minY = std::max(static_cast<int>(std::floor(localY / TILE_SIZE)), 0);
+    int maxX = std::min(static_cast<int>(std::floor((localX + view.width) / TILE_SIZE)), WIDTH - 1);
+    int maxY = std::min(static_cast<int>(std::floor((localY + view.height) / TILE_SIZE)), HEIGHT - 1);
+    if (minX > maxX || minY > maxY) return 0;
+    
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
             Vector2 worldPos = TileToWorld(x, y);
             worldPos.x += offset.x;
             worldPos.y += offset.y;
@@ -160,7 +243,7 @@ void Room::Render(Vector2 offset) {
             };
             
             Color color;
-            switch (m_tiles[y][x]) {
+            switch (GetTile(x, y)) {
                 case TileType::FLOOR:
                     color = Color{40, 40, 50, 255};
                     break;
@@ -182,6 +265,10 @@ void Room::Render(Vector2 offset) {
         }
     }
     
+    return 2 * (maxX - minX + 1) * (maxY - minY + 1);
+}
+
+void Room::RenderProps(Vector2 offset) {
     // Draw treasure chest if this is a treasure room with uncollected treasure
     if (m_type == RoomType::TREASURE && !m_treasureCollected) {
         Vector2 chestPos = {m_treasurePosition.x + offset.x, m_treasurePosition.y + offset.y};
@@ -224,49 +311,52 @@ void Room::Render(Vector2 offset) {
             // Price tag
             char priceText[16];
             snprintf(priceText, sizeof(priceText), "$%d", item.cost);
-            int priceWidth = MeasureText(priceText, 14);
-            DrawText(priceText, static_cast<int>(itemPos.x - priceWidth / 2), 
-                     static_cast<int>(itemPos.y + 25), 14, GOLD);
+            int priceWidth = Text::Measure(priceText, 14);
+            Text::Draw(priceText, static_cast<int>(itemPos.x - priceWidth / 2), 
+                       static_cast<int>(itemPos.y + 25), 14, GOLD);
             
             // Item name
-            int nameWidth = MeasureText(item.name.c_str(), 12);
-            DrawText(item.name.c_str(), static_cast<int>(itemPos.x - nameWidth / 2),
-                     static_cast<int>(itemPos.y - 35), 12, WHITE);
+            int nameWidth = Text::Measure(item.name.c_str(), 12);
+            Text::Draw(item.name.c_str(), static_cast<int>(itemPos.x - nameWidth / 2),
+                       static_cast<int>(itemPos.y - 35), 12, WHITE);
         }
         
         // Shop sign at top of room
         Vector2 signPos = TileToWorld(WIDTH / 2, 2);
         signPos.x += offset.x;
         signPos.y += offset.y;
-        DrawText("SHOP", static_cast<int>(signPos.x - 30), static_cast<int>(signPos.y - 10), 24, SKYBLUE);
-        DrawText("Walk into items to buy", static_cast<int>(signPos.x - 70), 
-                 static_cast<int>(signPos.y + 15), 12, LIGHTGRAY);
-    }
-}
-
-TileType Room::GetTile(int x, int y) const {
-    if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) {
-        return TileType::VOID;
+        Text::Draw("SHOP", static_cast<int>(signPos.x - 30), static_cast<int>(signPos.y - 10), 24, SKYBLUE);
+        Text::Draw("Walk into items to buy", static_cast<int>(signPos.x - 70), 
+                   static_cast<int>(signPos.y + 15), 12, LIGHTGRAY);
     }
-    return m_tiles[y][x];
 }
 
 void Room::SetTile(int x, int y, TileType tile) {
     if (x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT) {
-        m_tiles[y][x] = tile;
+        m_tiles[y * WIDTH + x] = static_cast<uint8_t>(tile);
+        ++m_tileRevision;
+        m_visibility.Clear();  // Stale now, queries fall back to raycasts
+        
+        uint16_t bit = static_cast<uint16_t>(1u << x);
+        if (tile == TileType::FLOOR || tile == TileType::DOOR) {
+            m_walkableRows[y] |= bit;
+        } else {
+            m_walkableRows[y] &= static_cast<uint16_t>(~bit);
+        }
     }
 }
 
-bool Room::IsWalkable(int x, int y) const {
-    TileType tile = GetTile(x, y);
-    return tile == TileType::FLOOR || tile == TileType::DOOR;
-}
-
-Vector2 Room::GetWorldPosition() const {
-    return {
-        static_cast<float>(m_gridX * WIDTH * TILE_SIZE),
-        static_cast<float>(m_gridY * HEIGHT * TILE_SIZE)
-    };
+void Room::RebuildWalkability() {
+    for (int y = 0; y < HEIGHT; ++y) {
+        uint16_t row = 0;
+        for (int x = 0; x < WIDTH; ++x) {
+            TileType tile = static_cast<TileType>(m_tiles[y * WIDTH + x]);
+            if (tile == TileType::FLOOR || tile == TileType::DOOR) {
+                row |= static_cast<uint16_t>(1u << x);
+            }
+        }
+        m_walkableRows[y] = row;
+    }
 }
 
 Vector2 Room::TileToWorld(int tileX, int tileY) const {
@@ -277,16 +367,6 @@ Vector2 Room::TileToWorld(int tileX, int tileY) const {
     };
 }
 
-bool Room::WorldToTile(Vector2 worldPos, int& tileX, int& tileY) const {
-    Vector2 roomPos = GetWorldPosition();
-    Vector2 localPos = Vector2Subtract(worldPos, roomPos);
-    
-    tileX = static_cast<int>(localPos.x / TILE_SIZE);
-    tileY = static_cast<int>(localPos.y / TILE_SIZE);
-    
-    return tileX >= 0 && tileX < WIDTH && tileY >= 0 && tileY < HEIGHT;
-}
-
 void Room::AddDoor(int direction, int connectedRoomId) {
     Door door;
     door.direction = direction;
@@ -315,14 +395,25 @@ bool Room::TryPurchaseItem(int index, Player* player) {
 DungeonManager::DungeonManager() {
 }
 
+DungeonManager::~DungeonManager() {
+    ReleaseMinimap();
+}
+
 void DungeonManager::Generate(unsigned int seed, int stage, int subLevel) {
     Utils::SeedRNG(seed);
     m_stage = stage;
     m_subLevel = subLevel;
+    
+    // Outstanding path searches may still point into the old rooms
+    PathRequestQueue::Instance().CancelAll();
+    m_cachedRoom = nullptr;
     m_rooms.clear();
+    m_roomsById.clear();
     m_portalActive = false;
+    ++m_minimapRevision;
     
     GenerateLayout(seed);
+    IndexRooms();
     ConnectRooms();
     
     // Generate each room
@@ -516,12 +607,26 @@ void DungeonManager::Update(float dt) {
     }
 }
 
-void DungeonManager::Render() {
+void DungeonManager::PrepareRender() {
+    Room* room = m_tileCacheEnabled ? m_currentRoom : nullptr;
+    
+    // Rooms drop their baked tiles when they stop being current
+    if (m_cachedRoom && m_cachedRoom != room) {
+        m_cachedRoom->ReleaseTileCache();
+    }
+    m_cachedRoom = room;
+    
+    if (room) {
+        room->UpdateTileCache();
+    }
+}
+
+void DungeonManager::Render(Rectangle view) {
     if (m_currentRoom) {
-        m_currentRoom->Render({0, 0});
+        m_currentRoom->Render({0, 0}, view);
         
-        // Draw portal if active
-        if (m_portalActive) {
+        // Draw portal if active (50 covers its pulse and the label)
+        if (m_portalActive && CheckCollisionCircleRec(m_portalPosition, 50.0f, view)) {
             // Animated portal effect
             float time = static_cast<float>(GetTime());
             float pulse = (sinf(time * 4.0f) + 1.0f) / 2.0f;
@@ -546,20 +651,31 @@ void DungeonManager::Render() {
             
             // Text
             const char* text = "NEXT";
-            int textWidth = MeasureText(text, 14);
-            DrawText(text, static_cast<int>(m_portalPosition.x - textWidth/2),
-                     static_cast<int>(m_portalPosition.y - 7), 14, WHITE);
+            int textWidth = Text::Measure(text, 14);
+            Text::Draw(text, static_cast<int>(m_portalPosition.x - textWidth/2),
+                       static_cast<int>(m_portalPosition.y - 7), 14, WHITE);
         }
     }
 }
 
-Room* DungeonManager::GetRoom(int id) {
-    for (auto& room : m_rooms) {
-        if (room->GetId() == id) {
-            return room.get();
+void DungeonManager::IndexRooms() {
+    int maxId = -1;
+    for (const auto& room : m_rooms) {
+        maxId = std::max(maxId, room->GetId());
+    }
+    
+    m_roomsById.assign(static_cast<size_t>(maxId + 1), nullptr);
+    for (const auto& room : m_rooms) {
+        int id = room->GetId();
+        if (id >= 0 && !m_roomsById[id]) {
+            m_roomsById[id] = room.get();  // First room wins, as the old linear search did
         }
     }
-    return nullptr;
+}
+
+Room* DungeonManager::GetRoom(int id) {
+    if (static_cast<unsigned>(id) >= m_roomsById.size()) return nullptr;
+    return m_roomsById[id];
 }
 
 void DungeonManager::SetCurrentRoom(int id) {
@@ -567,6 +683,7 @@ void DungeonManager::SetCurrentRoom(int id) {
     if (room) {
         m_currentRoom = room;
         m_currentRoom->SetVisited(true);  // Mark as visited when entering
+        ++m_minimapRevision;
         m_cameraTarget = room->GetWorldPosition();
         m_cameraOffset = m_cameraTarget;
     }
@@ -578,6 +695,7 @@ void DungeonManager::TransitionToRoom(int roomId, int fromDirection) {
     
     m_currentRoom = newRoom;
     m_currentRoom->SetVisited(true);  // Mark as visited when entering
+    ++m_minimapRevision;
     m_cameraTarget = newRoom->GetWorldPosition();
     m_transitioning = true;
     
@@ -605,13 +723,7 @@ void DungeonManager::TransitionToRoom(int roomId, int fromDirection) {
 }
 
 bool DungeonManager::IsWalkable(Vector2 worldPos) const {
-    if (!m_currentRoom) return false;
-    
-    int tileX, tileY;
-    if (m_currentRoom->WorldToTile(worldPos, tileX, tileY)) {
-        return m_currentRoom->IsWalkable(tileX, tileY);
-    }
-    return false;
+    return m_currentRoom && m_currentRoom->IsWalkableAt(worldPos);
 }
 
 bool DungeonManager::CheckDoorCollision(Vector2 worldPos, int& roomId, int& direction) {
@@ -672,6 +784,75 @@ int DungeonManager::CheckShopItemCollision(Vector2 worldPos) {
 void DungeonManager::RenderMinimap(float x, float y, float scale) {
     if (m_rooms.empty()) return;
     
+    if (m_minimapBakedRevision != m_minimapRevision || m_minimapBakedScale != scale) {
+        BakeMinimap(scale);
+    }
+    
+    if (m_minimapCache.id == 0) {
+        DrawMinimap(x, y, scale);  // No render target; draw it directly
+        return;
+    }
+    
+    // The bake stores premultiplied colour, so composite it the same way
+    float padding = 4.0f * scale;
+    Texture2D& texture = m_minimapCache.texture;
+    Rectangle source = {0, 0, static_cast<float>(texture.width), -static_cast<float>(texture.height)};
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTextureRec(texture, source, {x - padding, y - padding}, WHITE);
+    EndBlendMode();
+}
+
+void DungeonManager::BakeMinimap(float scale) {
+    PROFILE_COUNT("Minimap rebakes", 1);
+    
+    int minGridX = 0, maxGridX = 0;
+    int minGridY = 0, maxGridY = 0;
+    for (const auto& room : m_rooms) {
+        minGridX = std::min(minGridX, room->GetGridX());
+        maxGridX = std::max(maxGridX, room->GetGridX());
+        minGridY = std::min(minGridY, room->GetGridY());
+        maxGridY = std::max(maxGridY, room->GetGridY());
+    }
+    
+    // Same extents DrawMinimap covers, background included
+    float roomSize = 20.0f * scale;
+    float padding = 4.0f * scale;
+    int width = static_cast<int>(std::ceil((maxGridX - minGridX + 1) * (roomSize + padding) + 2 * padding));
+    int height = static_cast<int>(std::ceil((maxGridY - minGridY + 1) * (roomSize + padding) + 2 * padding));
+    
+    if (m_minimapCache.id != 0 &&
+        (m_minimapCache.texture.width != width || m_minimapCache.texture.height != height)) {
+        ReleaseMinimap();
+    }
+    if (m_minimapCache.id == 0) {
+        m_minimapCache = LoadRenderTexture(width, height);
+        if (m_minimapCache.id == 0) return;
+    }
+    
+    // Plain alpha blending would square the alpha of the translucent background
+    // when drawn over a cleared target; accumulate premultiplied colour instead
+    BeginTextureMode(m_minimapCache);
+    ClearBackground(BLANK);
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+                              RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    DrawMinimap(padding, padding, scale);
+    EndBlendMode();
+    EndTextureMode();
+    
+    m_minimapBakedRevision = m_minimapRevision;
+    m_minimapBakedScale = scale;
+}
+
+void DungeonManager::ReleaseMinimap() {
+    if (m_minimapCache.id != 0) {
+        UnloadRenderTexture(m_minimapCache);
+        m_minimapCache = {0};
+    }
+    m_minimapBakedRevision = 0;
+}
+
+void DungeonManager::DrawMinimap(float x, float y, float scale) {
     // Find bounds of the dungeon
     int minGridX = 0, maxGridX = 0;
     int minGridY = 0, maxGridY = 0;
@@ -4,130 +4,58 @@
 #include "Projectile.hpp"
 #include "Dungeon.hpp"
 #include "Pathfinding.hpp"
+#include "Visibility.hpp"
 #include "Utils.hpp"
 #include "SpriteManager.hpp"
 #include "AchievementManager.hpp"
+#include "Profiler.hpp"
+#include "RenderQueue.hpp"
+#include "SpatialGrid.hpp"
+#include "JobSystem.hpp"
 #include "raymath.h"
 #include <algorithm>
+#include <numeric>
 
-// Enemy implementation
-Enemy::Enemy(const EnemyData& data, Vector2 pos) 
-    : Entity(pos, 20.0f), m_data(data), m_health(data.maxHealth) {
-    // Configure the Seeker component (similar to Unity's AIPath settings)
-    m_seeker.repathRate = PATH_UPDATE_INTERVAL;  // How often to recalculate paths
-    m_seeker.pickNextWaypointDist = 20.0f;       // Distance to pick next waypoint
-    m_seeker.constrainInsideGraph = true;        // Keep on walkable tiles
-    
-    // Configure the AIPathHelper
-    m_pathHelper.speed = m_data.moveSpeed;
-    m_pathHelper.slowdownDistance = 30.0f;
-    m_pathHelper.endReachedDistance = 10.0f;
-}
-
-void Enemy::Update(float dt) {
-    if (IsDead()) return;
+// ============================================================================
+// Per-enemy behaviour
+// ============================================================================
+// Runs on job threads: writes only slot i (and its seeker), everything else
+// goes through out
+void EnemyManager::UpdateEnemy(int i, float dt, CommandBuffer& out) {
+    if (IsDead(i)) return;
     
     // Update status effect timers
-    if (m_immobilizeTimer > 0) {
-        m_immobilizeTimer -= dt;
+    if (m_immobilizeTimer[i] > 0) {
+        m_immobilizeTimer[i] -= dt;
     }
     
     // Skip AI update if immobilized
-    if (!IsImmobilized()) {
-        UpdateAI(dt);
-    }
-    
-    m_attackTimer -= dt;
-    m_stateTimer -= dt;
-    m_repositionTimer -= dt;
-    m_searchTimer -= dt;
-    m_pathUpdateTimer -= dt;
-}
-
-void Enemy::Render() {
-    if (IsDead()) return;
-    
-    // Get sprite type based on enemy type
-    SpriteType spriteType = SpriteType::ENEMY_SLIME;  // Default
-    switch (m_data.type) {
-        case EnemyType::SLIME: spriteType = SpriteType::ENEMY_SLIME; break;
-        case EnemyType::SKELETON: spriteType = SpriteType::ENEMY_SKELETON; break;
-        case EnemyType::BAT: spriteType = SpriteType::ENEMY_BAT; break;
-        case EnemyType::GOBLIN: spriteType = SpriteType::ENEMY_GOBLIN; break;
-        case EnemyType::MINI_BOSS_GOLEM: spriteType = SpriteType::ENEMY_GOLEM; break;
-    }
-    
-    // Draw enemy - use sprite if available, otherwise fallback to circle
-    Color bodyColor = IsImmobilized() ? ColorTint(m_data.color, SKYBLUE) : m_data.color;
-    
-    if (SpriteManager::Instance().HasSprite(spriteType)) {
-        // Draw sprite with tint
-        Color tint = IsImmobilized() ? ColorTint(WHITE, SKYBLUE) : WHITE;
-        SpriteManager::Instance().DrawFitRadius(spriteType, m_position, m_radius, 0.0f, tint);
-    } else {
-        // Fallback to primitive rendering
-        DrawCircleV(m_position, m_radius, bodyColor);
-    }
-    
-    // Draw stun indicator if immobilized
-    if (IsImmobilized()) {
-        DrawCircleLinesV(m_position, m_radius + 3, SKYBLUE);
+    if (!IsImmobilized(i)) {
+        if (m_thinkNow[i]) {
+            UpdateAI(i, dt, out);
+        } else {
+            Steer(i, dt, out);
+        }
     }
-    
-    // Draw health bar above enemy
-    float healthPercent = static_cast<float>(m_health) / m_data.maxHealth;
-    float barWidth = m_radius * 2;
-    float barHeight = 4;
-    Vector2 barPos = { m_position.x - barWidth/2, m_position.y - m_radius - 10 };
-    
-    DrawRectangle(static_cast<int>(barPos.x), static_cast<int>(barPos.y), 
-                  static_cast<int>(barWidth), static_cast<int>(barHeight), DARKGRAY);
-    DrawRectangle(static_cast<int>(barPos.x), static_cast<int>(barPos.y), 
-                  static_cast<int>(barWidth * healthPercent), static_cast<int>(barHeight), RED);
 }
 
-void Enemy::TakeDamage(int amount) {
-    m_health -= amount;
-    if (m_health < 0) m_health = 0;
+void EnemyManager::TakeDamage(int i, int amount) {
+    m_health[i] -= amount;
+    if (m_health[i] < 0) m_health[i] = 0;
 }
 
-void Enemy::Immobilize(float duration) {
-    m_immobilizeTimer = duration;
+bool EnemyManager::HasLineOfSight(int i) const {
+    if (!m_player || !m_room) return false;
+    return Visibility::HasLineOfSight(*m_room, m_position[i], m_player->GetPosition());
 }
 
-bool Enemy::HasLineOfSight() const {
-    Player* player = Game::Instance().GetPlayer();
-    DungeonManager* dungeon = Game::Instance().GetDungeon();
-    if (!player || !dungeon) return false;
-    
-    Vector2 playerPos = player->GetPosition();
-    Vector2 toPlayer = Vector2Subtract(playerPos, m_position);
-    float dist = Vector2Length(toPlayer);
+Vector2 EnemyManager::FindRepositionTarget(int i) const {
+    const Vector2 position = m_position[i];
+    DungeonManager* dungeon = m_dungeon;
+    if (!dungeon || !m_player) return position;
     
-    // Check several points along the line
-    int steps = static_cast<int>(dist / 20.0f);
-    if (steps < 1) steps = 1;
-    
-    Vector2 step = Vector2Scale(toPlayer, 1.0f / steps);
-    Vector2 checkPos = m_position;
-    
-    for (int i = 0; i < steps; ++i) {
-        checkPos = Vector2Add(checkPos, step);
-        if (!dungeon->IsWalkable(checkPos)) {
-            return false;
-        }
-    }
-    
-    return true;
-}
-
-Vector2 Enemy::FindRepositionTarget() const {
-    DungeonManager* dungeon = Game::Instance().GetDungeon();
-    Player* player = Game::Instance().GetPlayer();
-    if (!dungeon || !player) return m_position;
-    
-    Vector2 playerPos = player->GetPosition();
-    float preferredDist = GetPreferredDistance();
+    Vector2 playerPos = m_player->GetPosition();
+    float preferredDist = GetData(i).preferredDistance;
     
     // Try to find a position at preferred distance that has line of sight
     for (int attempt = 0; attempt < 8; ++attempt) {
@@ -137,516 +65,877 @@ Vector2 Enemy::FindRepositionTarget() const {
         
         if (dungeon->IsWalkable(testPos)) {
             // Verify we can reach it roughly
-            if (dungeon->IsWalkable(Vector2Lerp(m_position, testPos, 0.5f))) {
+            if (dungeon->IsWalkable(Vector2Lerp(position, testPos, 0.5f))) {
                 return testPos;
             }
         }
     }
     
     // Fallback: just move perpendicular to player
-    Vector2 toPlayer = Vector2Subtract(playerPos, m_position);
+    Vector2 toPlayer = Vector2Subtract(playerPos, position);
     Vector2 perpendicular = {-toPlayer.y, toPlayer.x};
     perpendicular = Vector2Normalize(perpendicular);
     
-    Vector2 testPos = Vector2Add(m_position, Vector2Scale(perpendicular, 50.0f));
+    Vector2 testPos = Vector2Add(position, Vector2Scale(perpendicular, 50.0f));
     if (dungeon->IsWalkable(testPos)) return testPos;
     
-    testPos = Vector2Add(m_position, Vector2Scale(perpendicular, -50.0f));
+    testPos = Vector2Add(position, Vector2Scale(perpendicular, -50.0f));
     if (dungeon->IsWalkable(testPos)) return testPos;
     
-    return m_position;
+    return position;
 }
 
-float Enemy::GetPreferredDistance() const {
-    switch (m_data.type) {
-        case EnemyType::SKELETON:
-            return 180.0f;  // Ranged - stay back
-        default:
-            return 30.0f;   // Melee - get close
+bool EnemyManager::UpdatePath(int i, Vector2 targetPos, CommandBuffer& out) {
+    Room* currentRoom = m_room;
+    if (!currentRoom) return false;
+    
+    m_pathUpdateTimer[i] = PATH_UPDATE_INTERVAL;
+    if (m_nav[i] < 0) {
+        // The pool can't grow during the parallel pass. Without a nav there's
+        // no path to follow this tick anyway, so the whole request can wait.
+        EnemyCommand command{EnemyCommand::Type::REQUEST_PATH, i, m_position[i]};
+        command.target = targetPos;
+        out.push_back(command);
+        return true;
     }
+    
+    StartPath(i, m_position[i], targetPos);
+    out.push_back({EnemyCommand::Type::SUBMIT_PATH, i});
+    return true;
 }
 
-void Enemy::UpdatePath(Vector2 targetPos) {
-    DungeonManager* dungeon = Game::Instance().GetDungeon();
-    if (!dungeon) return;
-    
-    Room* currentRoom = dungeon->GetCurrentRoom();
-    if (!currentRoom) return;
-    
-    // Use the new Seeker-based pathfinding
-    m_seeker.StartPath(m_position, targetPos, currentRoom);
-    
-    // Also update legacy path for compatibility
-    m_currentPath = m_seeker.GetCurrentPath().vectorPath;
-    m_pathUpdateTimer = PATH_UPDATE_INTERVAL;
+void EnemyManager::StartPath(int i, Vector2 from, Vector2 targetPos) {
+    // Result arrives asynchronously; keep a copy to fall back on if the
+    // seeker later drops its path
+    NavState* nav = &m_navPool[m_nav[i]];
+    nav->seeker.StartPath(from, targetPos, m_room, [nav](const Path& path) {
+        nav->fallbackPath = path.vectorPath;
+    });
 }
 
-void Enemy::MoveAlongPath(float dt, float speedMultiplier) {
-    DungeonManager* dungeon = Game::Instance().GetDungeon();
-    if (!dungeon) return;
+void EnemyManager::MoveAlongPath(int i, float dt, CommandBuffer& out, float speedMultiplier) {
+    if (m_nav[i] < 0) return;  // Never asked for a path
     
-    Room* currentRoom = dungeon->GetCurrentRoom();
+    DungeonManager* dungeon = m_dungeon;
+    Room* currentRoom = m_room;
     if (!currentRoom) return;
     
-    // Use the new Seeker-based movement if we have a seeker path
-    if (m_seeker.HasPath()) {
-        // Update path helper speed based on our move speed
-        m_pathHelper.speed = m_data.moveSpeed;
+    NavState& nav = m_navPool[m_nav[i]];
+    Vector2& position = m_position[i];
+    const float moveSpeed = GetData(i).moveSpeed;
+    
+    // Use the Seeker-based movement if we have a seeker path
+    if (nav.seeker.HasPath()) {
+        AIPathHelper pathHelper;
+        pathHelper.speed = moveSpeed;
+        pathHelper.slowdownDistance = 30.0f;
+        pathHelper.endReachedDistance = 10.0f;
         
         // Get target from current path destination
-        Vector2 target = m_seeker.GetCurrentPath().vectorPath.empty() ? 
-            m_position : m_seeker.GetCurrentPath().vectorPath.back();
+        const Path& path = nav.seeker.GetCurrentPath();
+        Vector2 target = path.vectorPath.empty() ? position : path.vectorPath.back();
         
-        // Use AIPathHelper for smooth movement
-        Vector2 newPos = m_pathHelper.MoveToward(m_seeker, m_position, target, 
-                                                   currentRoom, dt, speedMultiplier);
+        Vector2 newPos = pathHelper.MoveToward(nav.seeker, position, target,
+                                               currentRoom, dt, speedMultiplier);
+        if (nav.seeker.HasDeferredRequest()) {
+            out.push_back({EnemyCommand::Type::SUBMIT_PATH, i});  // Repathed
+        }
+        newPos = SteerCrowd(i, newPos, moveSpeed * speedMultiplier * dt);
         
         // Verify the new position is walkable (safety check)
         if (dungeon->IsWalkable(newPos)) {
-            m_position = newPos;
+            position = newPos;
         } else {
             // Path may be outdated, force recalculation
-            m_seeker.ClearPath();
+            nav.seeker.ClearPath();
         }
         return;
     }
     
-    // Fallback to legacy path following if no seeker path
-    if (m_currentPath.empty()) return;
+    // Otherwise follow the last path we were given
+    std::vector<Vector2>& fallback = nav.fallbackPath;
+    if (fallback.empty()) return;
     
-    // Remove waypoints we've already passed (using pickNextWaypointDist)
-    while (!m_currentPath.empty()) {
-        float distToFirst = Vector2Distance(m_position, m_currentPath[0]);
-        if (distToFirst < m_seeker.pickNextWaypointDist) {
-            m_currentPath.erase(m_currentPath.begin());
+    // Remove waypoints we've already passed
+    while (!fallback.empty()) {
+        float distToFirst = Vector2Distance(position, fallback[0]);
+        if (distToFirst < WAYPOINT_PICK_DISTANCE) {
+            fallback.erase(fallback.begin());
         } else {
             break;
         }
     }
     
-    if (m_currentPath.empty()) return;
+    if (fallback.empty()) return;
     
     // Move toward first waypoint in path
-    Vector2 nextWaypoint = m_currentPath[0];
-    Vector2 toWaypoint = Vector2Subtract(nextWaypoint, m_position);
+    Vector2 toWaypoint = Vector2Subtract(fallback[0], position);
     float distToWaypoint = Vector2Length(toWaypoint);
     
     if (distToWaypoint < 1.0f) return;  // Already there
     
     Vector2 moveDir = Vector2Normalize(toWaypoint);
-    Vector2 newPos = Vector2Add(m_position, 
-        Vector2Scale(moveDir, m_data.moveSpeed * speedMultiplier * dt));
+    const float maxStep = moveSpeed * speedMultiplier * dt;
+    Vector2 newPos = SteerCrowd(i, Vector2Add(position, Vector2Scale(moveDir, maxStep)), maxStep);
     
     // Verify the new position is walkable (safety check)
     if (dungeon->IsWalkable(newPos)) {
-        m_position = newPos;
+        position = newPos;
     } else {
         // Path may be outdated, force recalculation
-        m_pathUpdateTimer = 0;
-        m_currentPath.clear();
+        m_pathUpdateTimer[i] = 0;
+        fallback.clear();
     }
 }
 
-void Enemy::MoveWithSeeker(Vector2 targetPos, float dt, float speedMultiplier) {
-    // High-level movement using the Seeker component
-    // This mirrors the Unity AIPath behavior
-    
-    DungeonManager* dungeon = Game::Instance().GetDungeon();
-    if (!dungeon) return;
-    
-    Room* currentRoom = dungeon->GetCurrentRoom();
-    if (!currentRoom) return;
-    
-    // Update seeker timer
-    m_seeker.Update(dt);
-    
-    // Repath if needed (based on repathRate)
-    if (m_seeker.ShouldRepath() || !m_seeker.HasPath()) {
-        m_seeker.StartPath(m_position, targetPos, currentRoom);
-        m_seeker.ResetRepathTimer();
+bool EnemyManager::MoveAlongFlowField(int i, float dt, float speedMultiplier) {
+    DungeonManager* dungeon = m_dungeon;
+    if (!dungeon) return false;
+    
+    Vector2 moveDir;
+    if (!m_playerField.SampleDirection(m_position[i], moveDir)) return false;
+    
+    // Any A* path we had was toward the player too and is stale now
+    if (m_nav[i] >= 0) {
+        NavState& nav = m_navPool[m_nav[i]];
+        if (nav.seeker.HasPath()) nav.seeker.ClearPath();
+        nav.fallbackPath.clear();
     }
     
-    if (!m_seeker.HasPath()) return;
-    
-    // Use AIPathHelper for movement
-    m_pathHelper.speed = m_data.moveSpeed;
-    Vector2 newPos = m_pathHelper.MoveToward(m_seeker, m_position, targetPos,
-                                              currentRoom, dt, speedMultiplier);
+    const float maxStep = GetData(i).moveSpeed * speedMultiplier * dt;
+    Vector2 newPos = SteerCrowd(i, Vector2Add(m_position[i], Vector2Scale(moveDir, maxStep)), maxStep);
     
-    // Verify walkability (constrainInsideGraph)
-    if (m_seeker.constrainInsideGraph && !dungeon->IsWalkable(newPos)) {
-        m_seeker.ClearPath();  // Force repath
-        return;
+    // Verify the new position is walkable (safety check)
+    if (dungeon->IsWalkable(newPos)) {
+        m_position[i] = newPos;
     }
+    return true;
+}
+
+Vector2 EnemyManager::SteerCrowd(int i, Vector2 desiredPos, float maxStep) const {
+    if (!crowd.enabled || maxStep <= 0.0f) return desiredPos;
+    
+    // Neighbours are read at their tick-start positions, so the result
+    // doesn't depend on who already moved this tick (or on which thread)
+    const Vector2 position = m_position[i];
+    const float radius = m_radius[i];
+    Vector2 push = {0, 0};
+    int examined = 0;
+    int neighbors = 0;
+    
+    m_crowdGrid.ForEachCandidate(position, radius + crowd.padding, [&](int j) {
+        if (++examined > crowd.maxCandidates) return false;
+        if (j == i) return true;
+        
+        Vector2 away = Vector2Subtract(position, m_prevPosition[j]);
+        float minDist = radius + m_radius[j] + crowd.padding;
+        float distSq = Vector2LengthSqr(away);
+        if (distSq >= minDist * minDist) return true;
+        
+        float dist = sqrtf(distSq);
+        if (dist > 0.001f) {
+            away = Vector2Scale(away, 1.0f / dist);
+        } else {
+            // Exactly stacked: split along an angle both ids agree on
+            uint32_t low = std::min(m_id[i], m_id[j]);
+            float angle = static_cast<float>(low) * 2.39996f;  // Golden angle
+            away = {cosf(angle), sinf(angle)};
+            if (m_id[i] == low) away = Vector2Negate(away);
+        }
+        push = Vector2Add(push, Vector2Scale(away, (minDist - dist) / minDist));
+        return ++neighbors < crowd.maxNeighbors;
+    });
+    if (neighbors == 0) return desiredPos;
+    
+    Vector2 step = Vector2Subtract(desiredPos, position);
+    step = Vector2Add(step, Vector2Scale(push, crowd.separationWeight * maxStep));
+    step = Vector2ClampValue(step, 0.0f, maxStep);
+    
+    // Never let the crowd shove anyone into a wall the path avoided
+    Vector2 separated = Vector2Add(position, step);
+    return m_dungeon->IsWalkable(separated) ? separated : desiredPos;
+}
+
+void EnemyManager::BuildCrowdGrid() {
+    m_crowdGrid.Clear();
+    if (!crowd.enabled) return;
     
-    m_position = newPos;
+    for (int i = 0; i < GetCount(); ++i) {
+        if (!IsDead(i)) m_crowdGrid.Insert(i, m_prevPosition[i], m_radius[i]);
+    }
+    m_crowdGrid.Build();
+}
+
+void EnemyManager::ClearPath(int i) {
+    if (m_nav[i] >= 0) {
+        m_navPool[m_nav[i]].fallbackPath.clear();
+    }
 }
 
-void Enemy::UpdateAI(float dt) {
-    Player* player = Game::Instance().GetPlayer();
+void EnemyManager::UpdateAI(int i, float dt, CommandBuffer& out) {
+    Player* player = m_player;
     if (!player) return;
     
+    const EnemyData& data = GetData(i);
+    AIState& state = m_state[i];
+    
     Vector2 playerPos = player->GetPosition();
-    Vector2 toPlayer = Vector2Subtract(playerPos, m_position);
+    Vector2 toPlayer = Vector2Subtract(playerPos, m_position[i]);
     float distToPlayer = Vector2Length(toPlayer);
-    bool hasLOS = HasLineOfSight();
+    bool hasLOS = HasLineOfSight(i);
     
     // Track last known player position when we can see them
-    if (hasLOS && distToPlayer < m_data.detectionRange) {
-        m_lastKnownPlayerPos = playerPos;
+    if (hasLOS && distToPlayer < data.detectionRange) {
+        m_lastKnownPlayerPos[i] = playerPos;
     }
     
-    // Ranged enemy behavior (Skeleton)
-    bool isRanged = (m_data.type == EnemyType::SKELETON);
-    float preferredDist = GetPreferredDistance();
+    // Ranged enemies keep their distance
+    bool isRanged = (data.attack == EnemyAttack::RANGED);
+    float preferredDist = data.preferredDistance;
+    float attackRange = data.attackRange;
     
-    switch (m_aiState) {
+    switch (state) {
         case AIState::IDLE:
-            if (distToPlayer < m_data.detectionRange && hasLOS) {
-                m_aiState = AIState::CHASE;
+            if (distToPlayer < data.detectionRange && hasLOS) {
+                state = AIState::CHASE;
             }
             break;
-            
+        
         case AIState::CHASE:
-            if (distToPlayer > m_data.detectionRange * 1.5f) {
-                m_aiState = AIState::IDLE;
-                m_currentPath.clear();
+            if (distToPlayer > data.detectionRange * 1.5f) {
+                state = AIState::IDLE;
+                ClearPath(i);
             } else if (!hasLOS) {
                 // Lost sight of player - go to search mode
-                m_aiState = AIState::SEARCH;
-                m_searchTimer = 3.0f;  // Search for 3 seconds
-            } else if (distToPlayer < GetAttackRange()) {
+                state = AIState::SEARCH;
+                m_searchTimer[i] = 3.0f;  // Search for 3 seconds
+            } else if (distToPlayer < attackRange) {
                 // Close enough to attack
                 if (isRanged && distToPlayer < preferredDist * 0.6f) {
                     // Too close for ranged - need to reposition
-                    m_aiState = AIState::REPOSITION;
-                    m_repositionTarget = FindRepositionTarget();
-                    m_repositionTimer = 2.0f;
-                    m_pathUpdateTimer = 0;  // Force path update
+                    state = AIState::REPOSITION;
+                    out.push_back({EnemyCommand::Type::PICK_REPOSITION, i});
+                    m_repositionTimer[i] = 2.0f;
+                    m_pathUpdateTimer[i] = 0;  // Force path update
                 } else {
-                    m_aiState = AIState::ATTACK;
+                    state = AIState::ATTACK;
                 }
             } else {
-                // Use pathfinding to move toward player
-                if (m_pathUpdateTimer <= 0) {
-                    UpdatePath(playerPos);
-                }
-                MoveAlongPath(dt);
+                ChaseStep(i, dt, out);
             }
             break;
-            
+        
         case AIState::ATTACK:
             if (!hasLOS) {
-                m_aiState = AIState::SEARCH;
-                m_searchTimer = 3.0f;
-            } else if (distToPlayer > GetAttackRange() * 1.2f) {
-                m_aiState = AIState::CHASE;
+                state = AIState::SEARCH;
+                m_searchTimer[i] = 3.0f;
+            } else if (distToPlayer > attackRange * 1.2f) {
+                state = AIState::CHASE;
             } else if (isRanged && distToPlayer < preferredDist * 0.5f) {
                 // Too close - reposition
-                m_aiState = AIState::REPOSITION;
-                m_repositionTarget = FindRepositionTarget();
-                m_repositionTimer = 2.0f;
-            } else if (m_attackTimer <= 0) {
-                Attack();
-                m_attackTimer = m_data.attackCooldown;
+                state = AIState::REPOSITION;
+                out.push_back({EnemyCommand::Type::PICK_REPOSITION, i});
+                m_repositionTimer[i] = 2.0f;
+            } else if (m_attackTimer[i] <= 0) {
+                Attack(i, out);
+                m_attackTimer[i] = data.attackCooldown;
                 
                 // Ranged enemies reposition after attacking sometimes
-                if (isRanged && Utils::RandomFloat(0, 1) < 0.4f) {
-                    m_aiState = AIState::REPOSITION;
-                    m_repositionTarget = FindRepositionTarget();
-                    m_repositionTimer = 1.5f;
+                if (isRanged) {
+                    out.push_back({EnemyCommand::Type::ROLL_REPOSITION, i});
                 }
             }
             break;
-            
+        
         case AIState::REPOSITION: {
             // Move toward reposition target using pathfinding
-            Vector2 toTarget = Vector2Subtract(m_repositionTarget, m_position);
+            Vector2 toTarget = Vector2Subtract(m_repositionTarget[i], m_position[i]);
             float distToTarget = Vector2Length(toTarget);
             
-            if (distToTarget < 10.0f || m_repositionTimer <= 0) {
+            if (distToTarget < 10.0f || m_repositionTimer[i] <= 0) {
                 // Reached target or timeout - go back to chase/attack
-                m_aiState = (distToPlayer < GetAttackRange() && hasLOS) ? AIState::ATTACK : AIState::CHASE;
-                m_currentPath.clear();
+                state = (distToPlayer < attackRange && hasLOS) ? AIState::ATTACK : AIState::CHASE;
+                ClearPath(i);
             } else {
-                // Use pathfinding to reach reposition target
-                if (m_pathUpdateTimer <= 0) {
-                    UpdatePath(m_repositionTarget);
-                }
-                MoveAlongPath(dt, 1.2f);  // Move faster when repositioning
-                
-                // If path is empty but not at target, might be unreachable
-                if (m_currentPath.empty() && distToTarget > 20.0f) {
-                    m_aiState = AIState::CHASE;
-                }
+                RepositionStep(i, dt, out);
             }
             
             // Can still attack while repositioning if in range
-            if (hasLOS && distToPlayer < GetAttackRange() && m_attackTimer <= 0) {
-                Attack();
-                m_attackTimer = m_data.attackCooldown;
+            if (hasLOS && distToPlayer < attackRange && m_attackTimer[i] <= 0) {
+                Attack(i, out);
+                m_attackTimer[i] = data.attackCooldown;
             }
             break;
         }
-            
+        
         case AIState::SEARCH: {
             // Move toward last known player position
-            Vector2 toLastKnown = Vector2Subtract(m_lastKnownPlayerPos, m_position);
+            Vector2 toLastKnown = Vector2Subtract(m_lastKnownPlayerPos[i], m_position[i]);
             float distToLastKnown = Vector2Length(toLastKnown);
             
-            if (hasLOS && distToPlayer < m_data.detectionRange) {
+            if (hasLOS && distToPlayer < data.detectionRange) {
                 // Found player again
-                m_aiState = AIState::CHASE;
-                m_currentPath.clear();
-            } else if (m_searchTimer <= 0 || distToLastKnown < 20.0f) {
+                state = AIState::CHASE;
+                ClearPath(i);
+            } else if (m_searchTimer[i] <= 0 || distToLastKnown < 20.0f) {
                 // Gave up searching or reached last known position
-                m_aiState = AIState::IDLE;
-                m_currentPath.clear();
+                state = AIState::IDLE;
+                ClearPath(i);
             } else {
-                // Use pathfinding to move toward last known position
-                if (m_pathUpdateTimer <= 0) {
-                    UpdatePath(m_lastKnownPlayerPos);
-                }
-                MoveAlongPath(dt, 0.7f);  // Slower when searching
+                SearchStep(i, dt, out);
             }
             break;
         }
-            
+        
         case AIState::SPECIAL:
             // Boss-specific behavior
             break;
     }
 }
 
-void Enemy::Attack() {
-    Player* player = Game::Instance().GetPlayer();
+// Between thinks an enemy keeps doing what its state last decided; only
+// the movement part of each state runs
+void EnemyManager::Steer(int i, float dt, CommandBuffer& out) {
+    if (!m_player) return;
+    
+    switch (m_state[i]) {
+        case AIState::CHASE:      ChaseStep(i, dt, out); break;
+        case AIState::REPOSITION: RepositionStep(i, dt, out); break;
+        case AIState::SEARCH:     SearchStep(i, dt, out); break;
+        default: break;
+    }
+}
+
+void EnemyManager::ChaseStep(int i, float dt, CommandBuffer& out) {
+    // Follow the shared flow field toward the player, fall back to A* if the
+    // field has no route from here
+    if (!MoveAlongFlowField(i, dt)) {
+        if (m_pathUpdateTimer[i] <= 0) {
+            UpdatePath(i, m_player->GetPosition(), out);
+        }
+        MoveAlongPath(i, dt, out);
+    }
+}
+
+void EnemyManager::RepositionStep(int i, float dt, CommandBuffer& out) {
+    float distToTarget = Vector2Length(Vector2Subtract(m_repositionTarget[i], m_position[i]));
+    
+    // Use pathfinding to reach reposition target
+    bool requested = false;
+    if (m_pathUpdateTimer[i] <= 0) {
+        requested = UpdatePath(i, m_repositionTarget[i], out);
+    }
+    MoveAlongPath(i, dt, out, 1.2f);  // Move faster when repositioning
+    
+    // If path is empty but not at target, might be unreachable (a request
+    // made this tick counts as a path on its way)
+    bool noPath = !requested && (m_nav[i] < 0 ||
+        (m_navPool[m_nav[i]].fallbackPath.empty() && m_navPool[m_nav[i]].seeker.IsDone()));
+    if (noPath && distToTarget > 20.0f) {
+        m_state[i] = AIState::CHASE;
+    }
+}
+
+void EnemyManager::SearchStep(int i, float dt, CommandBuffer& out) {
+    // Use pathfinding to move toward last known position
+    if (m_pathUpdateTimer[i] <= 0) {
+        UpdatePath(i, m_lastKnownPlayerPos[i], out);
+    }
+    MoveAlongPath(i, dt, out, 0.7f);  // Slower when searching
+}
+
+void EnemyManager::Attack(int i, CommandBuffer& out) {
+    Player* player = m_player;
     if (!player) return;
     
-    // Different attack behavior based on type
-    switch (m_data.type) {
-        case EnemyType::SLIME:
-        case EnemyType::GOBLIN:
-            // Melee attack - direct damage if in range
-            if (CollidesWith(*player)) {
-                player->TakeDamage(m_data.damage);
+    const EnemyData& data = GetData(i);
+    const Vector2 position = m_position[i];
+    
+    float reach = m_radius[i] + player->GetRadius();
+    bool touching = Vector2DistanceSqr(position, player->GetPosition()) < reach * reach;
+    
+    switch (data.attack) {
+        case EnemyAttack::MELEE:
+            // Direct damage on contact
+            if (touching) {
+                out.push_back({EnemyCommand::Type::DAMAGE_PLAYER, i});
             }
             break;
-            
-        case EnemyType::SKELETON: {
-            // Ranged attack - shoot projectile
-            Vector2 dir = Vector2Normalize(
-                Vector2Subtract(player->GetPosition(), m_position));
-            Game::Instance().GetProjectiles()->SpawnProjectile(
-                m_position, dir, 200.0f, m_data.damage, false, false, PURPLE);
+        
+        case EnemyAttack::RANGED: {
+            // Shoot a projectile at the player
+            Vector2 dir = Vector2Normalize(Vector2Subtract(player->GetPosition(), position));
+            out.push_back({EnemyCommand::Type::SPAWN_PROJECTILE, i, position, dir});
             break;
         }
-            
-        case EnemyType::BAT:
-            // Quick dash attack
-            if (CollidesWith(*player)) {
-                player->TakeDamage(m_data.damage);
+        
+        case EnemyAttack::STOMP:
+            // AoE stomp (damage in radius)
+            if (Vector2Distance(position, player->GetPosition()) < data.attackRange) {
+                out.push_back({EnemyCommand::Type::DAMAGE_PLAYER, i});
             }
             break;
+    }
+}
+
+// Game thread, after the parallel pass. Chunks cover ascending slot ranges,
+// so walking them in order replays every effect (and every draw from the
+// shared RNG) in the order a serial update would have made it.
+void EnemyManager::ApplyCommands(int chunks) {
+    ProjectileManager* projectiles = Game::Instance().GetProjectiles();
+    
+    for (int chunk = 0; chunk < chunks; ++chunk) {
+        for (const EnemyCommand& command : m_commandBuffers[chunk]) {
+            const int i = command.slot;
+            const EnemyData& data = GetData(i);
             
-        case EnemyType::MINI_BOSS_GOLEM:
-            // AoE stomp (damage in radius)
-            if (Vector2Distance(m_position, player->GetPosition()) < 80.0f) {
-                player->TakeDamage(m_data.damage);
+            switch (command.type) {
+                case EnemyCommand::Type::DAMAGE_PLAYER:
+                    m_player->TakeDamage(data.damage);
+                    break;
+                
+                case EnemyCommand::Type::SPAWN_PROJECTILE:
+                    projectiles->SpawnProjectile(command.position, command.direction, data.projectileSpeed,
+                                                 data.damage, false, false, data.projectileColor);
+                    break;
+                
+                case EnemyCommand::Type::PICK_REPOSITION:
+                    m_repositionTarget[i] = FindRepositionTarget(i);
+                    break;
+                
+                case EnemyCommand::Type::ROLL_REPOSITION:
+                    if (Utils::RandomFloat(0, 1) < 0.4f) {
+                        m_state[i] = AIState::REPOSITION;
+                        m_repositionTarget[i] = FindRepositionTarget(i);
+                        m_repositionTimer[i] = 1.5f;
+                    }
+                    break;
+                
+                case EnemyCommand::Type::REQUEST_PATH:
+                    AcquireNav(i);
+                    StartPath(i, command.position, command.target);
+                    m_navPool[m_nav[i]].seeker.SubmitDeferred();
+                    break;
+                
+                case EnemyCommand::Type::SUBMIT_PATH:
+                    m_navPool[m_nav[i]].seeker.SubmitDeferred();
+                    break;
             }
-            break;
+        }
     }
 }
 
-float Enemy::GetAttackRange() const {
-    switch (m_data.type) {
-        case EnemyType::SKELETON:
-            return 250.0f;
-        case EnemyType::MINI_BOSS_GOLEM:
-            return 80.0f;
-        default:
-            return 30.0f;
-    }
-}
-
-// Factory methods
-EnemyData Enemy::CreateSlimeData() {
-    return {
-        EnemyType::SLIME,
-        "Slime",
-        30,             // maxHealth
-        50.0f,          // moveSpeed
-        5,              // damage
-        1.5f,           // attackCooldown
-        200.0f,         // detectionRange
-        5,              // currencyDrop
-        GREEN           // color
-    };
-}
-
-EnemyData Enemy::CreateSkeletonData() {
-    return {
-        EnemyType::SKELETON,
-        "Skeleton",
-        40,
-        30.0f,
-        10,
-        2.0f,
-        300.0f,
-        10,
-        BEIGE
-    };
-}
-
-EnemyData Enemy::CreateBatData() {
-    return {
-        EnemyType::BAT,
-        "Bat",
-        20,
-        120.0f,
-        8,
-        0.8f,
-        250.0f,
-        7,
-        DARKPURPLE
-    };
-}
-
-EnemyData Enemy::CreateGoblinData() {
-    return {
-        EnemyType::GOBLIN,
-        "Goblin",
-        50,
-        80.0f,
-        12,
-        1.2f,
-        220.0f,
-        12,
-        DARKGREEN
-    };
-}
-
-EnemyData Enemy::CreateGolemData() {
-    return {
-        EnemyType::MINI_BOSS_GOLEM,
-        "Stone Golem",
-        200,
-        25.0f,
-        25,
-        3.0f,
-        400.0f,
-        50,
-        GRAY
-    };
-}
-
-// EnemyManager implementation
-void EnemyManager::Update(float dt) {
-    for (auto& enemy : m_enemies) {
-        if (enemy) {
-            enemy->Update(dt);
+// ============================================================================
+// Think scheduling
+// ============================================================================
+namespace {
+    // Slice mask for an interval in ticks, rounded down to a power of two so
+    // the bucket test is a mask rather than a division (0 = every tick)
+    uint32_t SliceMask(int interval) {
+        uint32_t slices = 1;
+        while (static_cast<int>(slices * 2) <= interval && slices < 0x8000) slices *= 2;
+        return slices - 1;
+    }
+}
+
+void EnemyManager::ScheduleThinks() {
+    const int count = GetCount();
+    m_thinkNow.resize(count);
+    m_aiStats = EnemyAIStats();
+    ++m_aiTick;
+    
+    if (!aiSchedule.enabled || !m_player) {
+        std::fill(m_thinkNow.begin(), m_thinkNow.end(), 1);
+        m_aiStats.fullRate = count;
+        return;
+    }
+    
+    const uint32_t farMask = SliceMask(aiSchedule.farInterval);
+    const uint32_t idleMask = SliceMask(aiSchedule.idleInterval);
+    const Vector2 playerPos = m_player->GetPosition();
+    const float nearSq = aiSchedule.nearDistance * aiSchedule.nearDistance;
+    
+    // Sort everyone into full rate or a time slice. Bucketing by id keeps an
+    // enemy in the same slice as slots shift during compaction.
+    m_thinkCandidates.clear();
+    for (int i = 0; i < count; ++i) {
+        uint32_t mask = 0;
+        switch (m_state[i]) {
+            case AIState::ATTACK:
+            case AIState::SPECIAL:
+                break;
+            case AIState::CHASE:
+            case AIState::REPOSITION:
+                if (Vector2DistanceSqr(m_position[i], playerPos) >= nearSq) mask = farMask;
+                break;
+            case AIState::IDLE:
+            case AIState::SEARCH:
+                mask = idleMask;
+                break;
+        }
+        
+        if (mask == 0 || IsDead(i)) {
+            m_thinkNow[i] = 1;
+            m_thinkOverdue[i] = 0;
+            ++m_aiStats.fullRate;
+            continue;
+        }
+        
+        m_thinkNow[i] = 0;
+        if (m_thinkOverdue[i] || ((m_aiTick + m_id[i]) & mask) == 0) {
+            m_thinkCandidates.push_back(i);
+        } else {
+            ++m_aiStats.steered;
         }
     }
     
-    // Remove dead enemies
-    m_enemies.erase(
-        std::remove_if(m_enemies.begin(), m_enemies.end(),
-            [](const std::unique_ptr<Enemy>& e) { 
-                if (!e) return true;
-                if (e->IsDead()) {
-                    AchievementManager::Instance().UnlockAchievement("FIRST_BLOOD");
-                    return true;
-                }
-                return false; 
-            }),
-        m_enemies.end()
-    );
+    // Grant the budget round robin by id, starting after the last enemy
+    // granted, so a steady overload can't starve the high slots
+    const int candidates = static_cast<int>(m_thinkCandidates.size());
+    if (candidates == 0) return;
+    const int budget = aiSchedule.maxScheduledThinks > 0 ?
+        std::min(aiSchedule.maxScheduledThinks, candidates) : candidates;
+    
+    auto first = std::lower_bound(m_thinkCandidates.begin(), m_thinkCandidates.end(), m_thinkCursor,
+        [this](int slot, uint32_t id) { return m_id[slot] < id; });
+    int next = static_cast<int>(first - m_thinkCandidates.begin());
+    
+    for (int n = 0; n < candidates; ++n, ++next) {
+        if (next == candidates) next = 0;
+        int slot = m_thinkCandidates[next];
+        bool granted = n < budget;
+        m_thinkNow[slot] = granted ? 1 : 0;
+        m_thinkOverdue[slot] = granted ? 0 : 1;
+        if (granted) m_thinkCursor = m_id[slot] + 1;
+    }
+    
+    m_aiStats.scheduled = budget;
+    m_aiStats.deferred = candidates - budget;
+    m_aiStats.steered += m_aiStats.deferred;
 }
 
-void EnemyManager::Render() {
-    for (auto& enemy : m_enemies) {
-        if (enemy) {
-            enemy->Render();
+// ============================================================================
+// Pool management
+// ============================================================================
+int EnemyManager::AcquireNav(int i) {
+    if (m_nav[i] >= 0) return m_nav[i];
+    
+    if (!m_freeNav.empty()) {
+        m_nav[i] = m_freeNav.back();
+        m_freeNav.pop_back();
+        return m_nav[i];
+    }
+    
+    // Configure the Seeker component (similar to Unity's AIPath settings)
+    NavState& nav = m_navPool.emplace_back();
+    nav.seeker.repathRate = PATH_UPDATE_INTERVAL;           // How often to recalculate paths
+    nav.seeker.pickNextWaypointDist = WAYPOINT_PICK_DISTANCE;
+    nav.seeker.constrainInsideGraph = true;                 // Keep on walkable tiles
+    nav.seeker.deferSubmit = true;                          // Requests go out in ApplyCommands
+    m_nav[i] = static_cast<int>(m_navPool.size()) - 1;
+    return m_nav[i];
+}
+
+void EnemyManager::ReleaseNav(int nav) {
+    NavState& state = m_navPool[nav];
+    state.seeker.Reset();
+    state.fallbackPath.clear();
+    m_freeNav.push_back(nav);
+}
+
+void EnemyManager::RemoveDead() {
+    // Order-preserving compaction: update order, hit priority and the
+    // sorted id column all rely on slots keeping their relative order
+    const int count = GetCount();
+    int kept = 0;
+    for (int i = 0; i < count; ++i) {
+        if (IsDead(i)) {
+            AchievementManager::Instance().UnlockAchievement("FIRST_BLOOD");
+            if (m_nav[i] >= 0) ReleaseNav(m_nav[i]);
+            continue;
+        }
+        
+        if (kept != i) {
+            m_position[kept] = m_position[i];
+            m_prevPosition[kept] = m_prevPosition[i];
+            m_radius[kept] = m_radius[i];
+            m_health[kept] = m_health[i];
+            m_archetype[kept] = m_archetype[i];
+            m_state[kept] = m_state[i];
+            m_attackTimer[kept] = m_attackTimer[i];
+            m_repositionTimer[kept] = m_repositionTimer[i];
+            m_searchTimer[kept] = m_searchTimer[i];
+            m_immobilizeTimer[kept] = m_immobilizeTimer[i];
+            m_pathUpdateTimer[kept] = m_pathUpdateTimer[i];
+            m_thinkOverdue[kept] = m_thinkOverdue[i];
+            m_repositionTarget[kept] = m_repositionTarget[i];
+            m_lastKnownPlayerPos[kept] = m_lastKnownPlayerPos[i];
+            m_nav[kept] = m_nav[i];
+            m_id[kept] = m_id[i];
         }
+        ++kept;
     }
+    
+    if (kept == count) return;
+    
+    m_position.resize(kept);
+    m_prevPosition.resize(kept);
+    m_radius.resize(kept);
+    m_health.resize(kept);
+    m_archetype.resize(kept);
+    m_state.resize(kept);
+    m_attackTimer.resize(kept);
+    m_repositionTimer.resize(kept);
+    m_searchTimer.resize(kept);
+    m_immobilizeTimer.resize(kept);
+    m_pathUpdateTimer.resize(kept);
+    m_thinkOverdue.resize(kept);
+    m_repositionTarget.resize(kept);
+    m_lastKnownPlayerPos.resize(kept);
+    m_nav.resize(kept);
+    m_id.resize(kept);
+    ++m_rosterVersion;
 }
 
-void EnemyManager::Clear() {
-    m_enemies.clear();
+// ============================================================================
+// EnemyManager
+// ============================================================================
+// A room is WIDTH * HEIGHT cells of the crowd grid; a few hundred buckets
+// keep its per-tick rebuild cheap
+EnemyManager::EnemyManager()
+    : m_crowdGrid(static_cast<float>(Room::TILE_SIZE), 256)
+{
 }
 
-void EnemyManager::SpawnEnemy(EnemyType type, Vector2 pos) {
-    EnemyData data;
+void EnemyManager::Update(float dt) {
+    PROFILE_SCOPE("EnemyManager::Update");
     
-    switch (type) {
-        case EnemyType::SLIME:
-            data = Enemy::CreateSlimeData();
-            break;
-        case EnemyType::SKELETON:
-            data = Enemy::CreateSkeletonData();
-            break;
-        case EnemyType::BAT:
-            data = Enemy::CreateBatData();
-            break;
-        case EnemyType::GOBLIN:
-            data = Enemy::CreateGoblinData();
-            break;
-        case EnemyType::MINI_BOSS_GOLEM:
-            data = Enemy::CreateGolemData();
-            break;
+    // Sync point for asynchronous path requests - finished paths are handed
+    // to their seekers here, before anyone moves
+    PathRequestQueue::Instance().Update();
+    
+    // Everything the AI reads from the rest of the game, looked up once
+    m_player = Game::Instance().GetPlayer();
+    m_dungeon = Game::Instance().GetDungeon();
+    m_room = m_dungeon ? m_dungeon->GetCurrentRoom() : nullptr;
+    
+    // Refresh the chase field (only rebuilds when the player changes tile)
+    if (GetCount() > 0 && m_player && m_dungeon) {
+        m_playerField.Update(m_room, m_player->GetPosition());
+    }
+    
+    ScheduleThinks();
+    PROFILE_COUNT("AI thinks (full rate)", m_aiStats.fullRate);
+    PROFILE_COUNT("AI thinks (scheduled)", m_aiStats.scheduled);
+    PROFILE_COUNT("AI thinks deferred", m_aiStats.deferred);
+    PROFILE_COUNT("AI think budget", aiSchedule.maxScheduledThinks);
+    
+    m_prevPosition = m_position;
+    BuildCrowdGrid();
+    const int count = GetCount();
+    const int chunks = JobSystem::GetChunkCount(count, UPDATE_CHUNK);
+    if (static_cast<int>(m_commandBuffers.size()) < chunks) {
+        m_commandBuffers.resize(chunks);
+    }
+    for (int chunk = 0; chunk < chunks; ++chunk) {
+        m_commandBuffers[chunk].clear();
+    }
+    
+    // Think and move; each chunk writes its own slots and command buffer
+    JobSystem& jobs = JobSystem::Instance();
+    jobs.ParallelFor(count, UPDATE_CHUNK, [this, dt](int begin, int end, int chunk) {
+        PROFILE_SCOPE("EnemyManager::UpdateChunk");
+        CommandBuffer& out = m_commandBuffers[chunk];
+        for (int i = begin; i < end; ++i) {
+            UpdateEnemy(i, dt, out);
+        }
+    });
+    PROFILE_COUNT("Enemy update chunks", chunks);
+    PROFILE_COUNT("Enemy chunks stolen", jobs.GetStealsLastRun());
+    
+    ApplyCommands(chunks);
+    
+    // Cooldowns run down after the effects so a timer set by one (the
+    // reposition roll) ages this tick like one set during the pass
+    for (int i = 0; i < count; ++i) {
+        if (IsDead(i)) continue;
+        m_attackTimer[i] -= dt;
+        m_repositionTimer[i] -= dt;
+        m_searchTimer[i] -= dt;
+        m_pathUpdateTimer[i] -= dt;
+    }
+    
+    RemoveDead();
+}
+
+void EnemyManager::Render(Rectangle view, const SpatialGrid* grid) {
+    if (grid) {
+        grid->CollectInRect(view, m_visible);
+    } else {
+        m_visible.resize(GetCount());
+        std::iota(m_visible.begin(), m_visible.end(), 0);
+    }
+    
+    RenderQueue& queue = RenderQueue::Instance();
+    SpriteManager& sprites = SpriteManager::Instance();
+    
+    // Ascending indices keep the usual draw order for overlapping enemies
+    const float alpha = Game::Instance().GetInterpolationAlpha();
+    int drawn = 0;
+    for (int i : m_visible) {
+        if (IsDead(i)) continue;
+        
+        Vector2 pos = GetRenderPosition(i, alpha);
+        float radius = m_radius[i];
+        if (!CheckCollisionCircleRec(pos, radius, view)) continue;
+        
+        const EnemyData& data = GetData(i);
+        bool immobilized = IsImmobilized(i);
+        
+        // Draw enemy - use sprite if available, otherwise fallback to circle
+        if (data.sprite != SpriteType::COUNT && sprites.HasSprite(data.sprite)) {
+            Color tint = immobilized ? ColorTint(WHITE, SKYBLUE) : WHITE;
+            sprites.QueueFitRadius(RenderLayer::BODIES, data.sprite, pos, radius, 0.0f, tint);
+        } else {
+            Color bodyColor = immobilized ? ColorTint(data.color, SKYBLUE) : data.color;
+            queue.PushCircle(RenderLayer::BODIES, pos, radius, bodyColor);
+        }
+        
+        // Draw stun indicator if immobilized
+        if (immobilized) {
+            queue.PushCircleLines(RenderLayer::INDICATORS, pos, radius + 3, SKYBLUE);
+        }
+        
+        // Draw health bar above enemy (all bars go out as one batch after the bodies)
+        float healthPercent = static_cast<float>(m_health[i]) / data.maxHealth;
+        float barWidth = radius * 2;
+        float barHeight = 4;
+        float barX = static_cast<float>(static_cast<int>(pos.x - barWidth/2));
+        float barY = static_cast<float>(static_cast<int>(pos.y - radius - 10));
+        queue.PushRect(RenderLayer::HEALTH_BARS, {barX, barY,
+                       static_cast<float>(static_cast<int>(barWidth)), barHeight}, DARKGRAY);
+        queue.PushRect(RenderLayer::HEALTH_BARS, {barX, barY,
+                       static_cast<float>(static_cast<int>(barWidth * healthPercent)), barHeight}, RED);
+        ++drawn;
+    }
+    PROFILE_COUNT("Enemies drawn", drawn);
+}
+
+void EnemyManager::Clear() {
+    ++m_rosterVersion;
+    for (int nav : m_nav) {
+        if (nav >= 0) ReleaseNav(nav);
     }
     
-    m_enemies.push_back(std::make_unique<Enemy>(data, pos));
+    m_position.clear();
+    m_prevPosition.clear();
+    m_radius.clear();
+    m_health.clear();
+    m_archetype.clear();
+    m_state.clear();
+    m_attackTimer.clear();
+    m_repositionTimer.clear();
+    m_searchTimer.clear();
+    m_immobilizeTimer.clear();
+    m_pathUpdateTimer.clear();
+    m_thinkOverdue.clear();
+    m_repositionTarget.clear();
+    m_lastKnownPlayerPos.clear();
+    m_nav.clear();
+    m_id.clear();
+    
+    m_playerField.Invalidate();
+    PathRequestQueue::Instance().CancelAll();
+}
+
+void EnemyManager::SpawnEnemy(int archetype, Vector2 pos) {
+    const EnemyData& data = EnemyRegistry::Instance().Get(archetype);
+    
+    m_position.push_back(pos);
+    m_prevPosition.push_back(pos);
+    m_radius.push_back(data.radius);
+    m_health.push_back(data.maxHealth);
+    m_archetype.push_back(static_cast<uint16_t>(archetype));
+    m_state.push_back(AIState::IDLE);
+    m_attackTimer.push_back(0.0f);
+    m_repositionTimer.push_back(0.0f);
+    m_searchTimer.push_back(0.0f);
+    m_immobilizeTimer.push_back(0.0f);
+    m_pathUpdateTimer.push_back(0.0f);
+    m_thinkOverdue.push_back(0);
+    m_repositionTarget.push_back({0, 0});
+    m_lastKnownPlayerPos.push_back({0, 0});
+    m_nav.push_back(-1);
+    m_id.push_back(m_nextId++);
+    ++m_rosterVersion;
 }
 
 void EnemyManager::SpawnEnemiesInRoom(const std::vector<Vector2>& spawnPoints, int difficulty) {
     // Number of enemies scales with difficulty
-    int numEnemies = std::min(static_cast<int>(spawnPoints.size()), 
+    int numEnemies = std::min(static_cast<int>(spawnPoints.size()),
                               2 + difficulty);
     
-    std::vector<EnemyType> availableTypes = {
-        EnemyType::SLIME,
-        EnemyType::SKELETON,
-        EnemyType::BAT,
-        EnemyType::GOBLIN
-    };
-    
-    for (int i = 0; i < numEnemies && i < static_cast<int>(spawnPoints.size()); ++i) {
-        // Random enemy type with difficulty weighting
-        int typeIndex = Utils::RandomInt(0, std::min(difficulty, 
-            static_cast<int>(availableTypes.size()) - 1));
-        SpawnEnemy(availableTypes[typeIndex], spawnPoints[i]);
+    // Minions in registry order; higher difficulty unlocks later entries
+    const EnemyRegistry& registry = EnemyRegistry::Instance();
+    const std::vector<int>& minions = registry.GetSpawnPool(EnemySpawnRole::MINION);
+    const std::vector<int>& minibosses = registry.GetSpawnPool(EnemySpawnRole::MINIBOSS);
+    
+    if (!minions.empty()) {
+        for (int i = 0; i < numEnemies && i < static_cast<int>(spawnPoints.size()); ++i) {
+            // Random enemy type with difficulty weighting
+            int typeIndex = Utils::RandomInt(0, std::min(difficulty,
+                static_cast<int>(minions.size()) - 1));
+            SpawnEnemy(minions[typeIndex], spawnPoints[i]);
+        }
     }
     
     // Chance to spawn miniboss on higher floors
     if (difficulty >= 3 && Utils::RandomFloat(0, 1) < 0.2f) {
-        if (!spawnPoints.empty()) {
-            SpawnEnemy(EnemyType::MINI_BOSS_GOLEM, 
-                       spawnPoints[spawnPoints.size() / 2]);
+        if (!spawnPoints.empty() && !minibosses.empty()) {
+            int pick = minibosses.size() > 1 ?
+                Utils::RandomInt(0, static_cast<int>(minibosses.size()) - 1) : 0;
+            SpawnEnemy(minibosses[pick], spawnPoints[spawnPoints.size() / 2]);
         }
     }
 }
 
+int EnemyManager::FindById(uint32_t id) const {
+    // Ids are handed out in spawn order and compaction keeps slot order, so
+    // the column is sorted
+    auto it = std::lower_bound(m_id.begin(), m_id.end(), id);
+    if (it == m_id.end() || *it != id) return -1;
+    return static_cast<int>(it - m_id.begin());
+}
+
 int EnemyManager::GetActiveCount() const {
     int count = 0;
-    for (const auto& enemy : m_enemies) {
-        if (enemy && !enemy->IsDead()) {
+    for (int health : m_health) {
+        if (health > 0) {
             ++count;
         }
     }
     return count;
 }
 
-Enemy* EnemyManager::GetNearestEnemy(Vector2 pos, float maxRange) {
-    Enemy* nearest = nullptr;
+int EnemyManager::GetNearestEnemy(Vector2 pos, float maxRange, bool requireLineOfSight) const {
+    int nearest = -1;
     float nearestDist = maxRange;
     
-    for (auto& enemy : m_enemies) {
-        if (!enemy || enemy->IsDead()) continue;
+    const Room* room = nullptr;
+    if (requireLineOfSight) {
+        DungeonManager* dungeon = Game::Instance().GetDungeon();
+        room = dungeon ? dungeon->GetCurrentRoom() : nullptr;
+    }
+    
+    const int count = GetCount();
+    for (int i = 0; i < count; ++i) {
+        if (IsDead(i)) continue;
         
-        float dist = Vector2Distance(pos, enemy->GetPosition());
+        float dist = Vector2Distance(pos, m_position[i]);
         if (dist < nearestDist) {
+            if (room && !Visibility::HasLineOfSight(*room, pos, m_position[i])) continue;
             nearestDist = dist;
-            nearest = enemy.get();
+            nearest = i;
         }
     }
     
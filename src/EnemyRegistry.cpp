@@ -0,0 +1,265 @@
+#include "EnemyRegistry.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+
+namespace {
+    std::string Trim(const std::string& text) {
+        size_t start = 0;
+        size_t end = text.size();
+        while (start < end && std::isspace(static_cast<unsigned char>(text[start]))) ++start;
+        while (end > start && std::isspace(static_cast<unsigned char>(text[end - 1]))) --end;
+        return text.substr(start, end - start);
+    }
+
+    bool ParseInt(const std::string& text, int& out) {
+        char* end = nullptr;
+        long value = std::strtol(text.c_str(), &end, 10);
+        if (end == text.c_str() || *end != '\0') return false;
+        out = static_cast<int>(value);
+        return true;
+    }
+
+    bool ParseFloat(const std::string& text, float& out) {
+        char* end = nullptr;
+        float value = std::strtof(text.c_str(), &end);
+        if (end == text.c_str() || *end != '\0') return false;
+        out = value;
+        return true;
+    }
+
+    // Speeds, cooldowns and ranges: a negative one would run the enemy backwards
+    // or let it attack every tick
+    bool ParseNonNegative(const std::string& text, float& out) {
+        float value = 0.0f;
+        if (!ParseFloat(text, value) || !(value >= 0.0f)) return false;
+        out = value;
+        return true;
+    }
+
+    // "r, g, b" or "r, g, b, a", 0-255 each
+    bool ParseColor(const std::string& text, Color& out) {
+        int channels[4] = {0, 0, 0, 255};
+        int count = 0;
+        size_t start = 0;
+        while (count < 4) {
+            size_t comma = text.find(',', start);
+            std::string part = Trim(text.substr(start, comma == std::string::npos ? std::string::npos : comma - start));
+            if (!ParseInt(part, channels[count]) || channels[count] < 0 || channels[count] > 255) return false;
+            ++count;
+            if (comma == std::string::npos) break;
+            start = comma + 1;
+        }
+        if (count < 3) return false;
+        out = {static_cast<unsigned char>(channels[0]), static_cast<unsigned char>(channels[1]),
+               static_cast<unsigned char>(channels[2]), static_cast<unsigned char>(channels[3])};
+        return true;
+    }
+
+    bool ParseSprite(const std::string& text, SpriteType& out) {
+        if (text == "none") {
+            out = SpriteType::COUNT;
+            return true;
+        }
+        for (int i = 0; i < static_cast<int>(SpriteType::COUNT); ++i) {
+            SpriteType type = static_cast<SpriteType>(i);
+            if (text == SpriteManager::GetSpriteName(type)) {
+                out = type;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    EnemyData MakeArchetype(const char* key, const char* name, int maxHealth, float moveSpeed,
+                            int damage, float attackCooldown, float detectionRange,
+                            int currencyDrop, Color color) {
+        EnemyData data;
+        data.key = key;
+        data.name = name;
+        data.maxHealth = maxHealth;
+        data.moveSpeed = moveSpeed;
+        data.damage = damage;
+        data.attackCooldown = attackCooldown;
+        data.detectionRange = detectionRange;
+        data.currencyDrop = currencyDrop;
+        data.color = color;
+        return data;
+    }
+}
+
+EnemyRegistry& EnemyRegistry::Instance() {
+    static EnemyRegistry instance;
+    return instance;
+}
+
+EnemyRegistry::EnemyRegistry() {
+    Reset();
+}
+
+void EnemyRegistry::Reset() {
+    m_archetypes.clear();
+
+    // In EnemyType order
+    m_archetypes.push_back(MakeArchetype("slime", "Slime", 30, 50.0f, 5, 1.5f, 200.0f, 5, GREEN));
+    m_archetypes.back().sprite = SpriteType::ENEMY_SLIME;
+    m_archetypes.back().spawnRole = EnemySpawnRole::MINION;
+
+    m_archetypes.push_back(MakeArchetype("skeleton", "Skeleton", 40, 30.0f, 10, 2.0f, 300.0f, 10, BEIGE));
+    m_archetypes.back().attack = EnemyAttack::RANGED;
+    m_archetypes.back().attackRange = 250.0f;
+    m_archetypes.back().preferredDistance = 180.0f;
+    m_archetypes.back().sprite = SpriteType::ENEMY_SKELETON;
+    m_archetypes.back().spawnRole = EnemySpawnRole::MINION;
+
+    m_archetypes.push_back(MakeArchetype("bat", "Bat", 20, 120.0f, 8, 0.8f, 250.0f, 7, DARKPURPLE));
+    m_archetypes.back().sprite = SpriteType::ENEMY_BAT;
+    m_archetypes.back().spawnRole = EnemySpawnRole::MINION;
+
+    m_archetypes.push_back(MakeArchetype("goblin", "Goblin", 50, 80.0f, 12, 1.2f, 220.0f, 12, DARKGREEN));
+    m_archetypes.back().sprite = SpriteType::ENEMY_GOBLIN;
+    m_archetypes.back().spawnRole = EnemySpawnRole::MINION;
+
+    m_archetypes.push_back(MakeArchetype("golem", "Stone Golem", 200, 25.0f, 25, 3.0f, 400.0f, 50, GRAY));
+    m_archetypes.back().attack = EnemyAttack::STOMP;
+    m_archetypes.back().attackRange = 80.0f;
+    m_archetypes.back().sprite = SpriteType::ENEMY_GOLEM;
+    m_archetypes.back().spawnRole = EnemySpawnRole::MINIBOSS;
+
+    RebuildSpawnPools();
+}
+
+bool EnemyRegistry::Load(const std::string& path) {
+    Reset();
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        TraceLog(LOG_INFO, "EnemyRegistry: %s not found, using built-in archetypes", path.c_str());
+        return false;
+    }
+
+    EnemyData* current = nullptr;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        line = Trim(line.substr(0, line.find_first_of("#;")));
+        if (line.empty()) continue;
+
+        if (line.front() == '[') {
+            if (line.back() != ']') {
+                TraceLog(LOG_WARNING, "EnemyRegistry: %s:%d: expected ']' to end the section name",
+                         path.c_str(), lineNumber);
+                current = nullptr;
+                continue;
+            }
+
+            std::string key = Trim(line.substr(1, line.size() - 2));
+            if (key.empty()) {
+                TraceLog(LOG_WARNING, "EnemyRegistry: %s:%d: empty section name", path.c_str(), lineNumber);
+                current = nullptr;
+                continue;
+            }
+
+            int index = Find(key);
+            if (index < 0) {
+                // New kind: defaults from the EnemyData initializers
+                EnemyData data;
+                data.key = key;
+                data.name = key;
+                m_archetypes.push_back(data);
+                index = GetCount() - 1;
+            }
+            current = &m_archetypes[index];
+            continue;
+        }
+
+        size_t equals = line.find('=');
+        if (!current || equals == std::string::npos) {
+            TraceLog(LOG_WARNING, "EnemyRegistry: %s:%d: expected [section] or field = value",
+                     path.c_str(), lineNumber);
+            continue;
+        }
+
+        std::string field = Trim(line.substr(0, equals));
+        std::string value = Trim(line.substr(equals + 1));
+        if (!ApplyField(*current, field, value)) {
+            TraceLog(LOG_WARNING, "EnemyRegistry: %s:%d: bad value for '%s' in [%s]",
+                     path.c_str(), lineNumber, field.c_str(), current->key.c_str());
+        }
+    }
+
+    RebuildSpawnPools();
+    TraceLog(LOG_INFO, "EnemyRegistry: %d archetypes (%s)", GetCount(), path.c_str());
+    return true;
+}
+
+bool EnemyRegistry::ApplyField(EnemyData& data, const std::string& field, const std::string& value) {
+    if (field == "name") { data.name = value; return !value.empty(); }
+    if (field == "health") {
+        int health = 0;
+        if (!ParseInt(value, health) || health <= 0) return false;
+        data.maxHealth = health;
+        return true;
+    }
+    if (field == "speed") return ParseNonNegative(value, data.moveSpeed);
+    if (field == "damage") return ParseInt(value, data.damage);
+    if (field == "attack_cooldown") return ParseNonNegative(value, data.attackCooldown);
+    if (field == "detection_range") return ParseNonNegative(value, data.detectionRange);
+    if (field == "currency") return ParseInt(value, data.currencyDrop);
+    if (field == "color") return ParseColor(value, data.color);
+    if (field == "attack_range") return ParseNonNegative(value, data.attackRange);
+    if (field == "preferred_distance") return ParseNonNegative(value, data.preferredDistance);
+    if (field == "projectile_speed") return ParseNonNegative(value, data.projectileSpeed);
+    if (field == "projectile_color") return ParseColor(value, data.projectileColor);
+    if (field == "radius") {
+        float radius = 0.0f;
+        if (!ParseFloat(value, radius) || radius <= 0.0f) return false;
+        data.radius = radius;
+        return true;
+    }
+    if (field == "sprite") return ParseSprite(value, data.sprite);
+
+    if (field == "attack") {
+        if (value == "melee") data.attack = EnemyAttack::MELEE;
+        else if (value == "ranged") data.attack = EnemyAttack::RANGED;
+        else if (value == "stomp") data.attack = EnemyAttack::STOMP;
+        else return false;
+        return true;
+    }
+
+    if (field == "spawn") {
+        if (value == "none") data.spawnRole = EnemySpawnRole::NONE;
+        else if (value == "minion") data.spawnRole = EnemySpawnRole::MINION;
+        else if (value == "miniboss") data.spawnRole = EnemySpawnRole::MINIBOSS;
+        else return false;
+        return true;
+    }
+
+    return false;
+}
+
+int EnemyRegistry::Find(const std::string& key) const {
+    for (int i = 0; i < GetCount(); ++i) {
+        if (m_archetypes[i].key == key) return i;
+    }
+    return -1;
+}
+
+const std::vector<int>& EnemyRegistry::GetSpawnPool(EnemySpawnRole role) const {
+    switch (role) {
+        case EnemySpawnRole::MINION: return m_minions;
+        case EnemySpawnRole::MINIBOSS: return m_minibosses;
+        default: return m_noPool;
+    }
+}
+
+void EnemyRegistry::RebuildSpawnPools() {
+    m_minions.clear();
+    m_minibosses.clear();
+    for (int i = 0; i < GetCount(); ++i) {
+        if (m_archetypes[i].spawnRole == EnemySpawnRole::MINION) m_minions.push_back(i);
+        if (m_archetypes[i].spawnRole == EnemySpawnRole::MINIBOSS) m_minibosses.push_back(i);
+    }
+}
@@ -2,26 +2,51 @@
 #include "Player.hpp"
 #include "Dungeon.hpp"
 #include "Enemy.hpp"
+#include "EnemyRegistry.hpp"
 #include "Projectile.hpp"
 #include "UI.hpp"
 #include "Utils.hpp"
 #include "SpriteManager.hpp"
 #include "AchievementManager.hpp"
+#include "Input.hpp"
+#include "SpatialGrid.hpp"
+#include "Pathfinding.hpp"
+#include "JobSystem.hpp"
+#include "Profiler.hpp"
+#include "RenderQueue.hpp"
+#include "TextCache.hpp"
+#include <algorithm>
 #include <ctime>
+#include <thread>
 
 Game& Game::Instance() {
     static Game instance;
     return instance;
 }
 
-void Game::Init() {
-    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Codename: Epitome");
-    SetTargetFPS(TARGET_FPS);
-    
-    AchievementManager::Instance().Init();
+void Game::Init(const GameConfig& config) {
+    m_initStart = std::chrono::steady_clock::now();
+    m_firstFrameLogged = false;
+    m_config = config;
+    Profiler::Instance().SetThreadName("Game");
+    m_config.tickRate = std::max(m_config.tickRate, 1);
+    m_config.maxCatchUpSteps = std::max(m_config.maxCatchUpSteps, 1);
+    m_floorsGenerated = 0;
+    
+    if (!m_config.headless) {
+        InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Codename: Epitome");
+        SetTargetFPS(TARGET_FPS);
+        
+        // Achievements persist to disk, keep simulation runs from touching them
+        AchievementManager::Instance().Init();
+        
+        // Initialize sprite manager first (needs window to be open); sprites
+        // stream in over the first frames
+        SpriteManager::Instance().Init();
+    }
     
-    // Initialize sprite manager first (needs window to be open)
-    SpriteManager::Instance().Init();
+    // Archetypes are fixed for the rest of the session; enemies index into them
+    EnemyRegistry::Instance().Load(m_config.enemyDataPath);
     
     // Initialize subsystems
     m_player = std::make_unique<Player>();
@@ -29,6 +54,23 @@ void Game::Init() {
     m_enemies = std::make_unique<EnemyManager>();
     m_projectiles = std::make_unique<ProjectileManager>();
     m_ui = std::make_unique<UIManager>();
+    m_enemyGrid = std::make_unique<SpatialGrid>(static_cast<float>(Room::TILE_SIZE));
+    
+    // Path searches are tiny (15x11 grid); a couple of workers is plenty
+    int pathWorkers = m_config.pathWorkers;
+    if (pathWorkers < 0) {
+        int cores = static_cast<int>(std::thread::hardware_concurrency());
+        pathWorkers = std::clamp(cores - 1, 0, 2);
+    }
+    PathRequestQueue::Instance().Start(pathWorkers);
+    
+    // Parallel loops (enemy update); results don't depend on the count
+    int jobWorkers = m_config.jobWorkers;
+    if (jobWorkers < 0) {
+        int cores = static_cast<int>(std::thread::hardware_concurrency());
+        jobWorkers = std::clamp(cores - 1, 0, 7);
+    }
+    JobSystem::Instance().Start(jobWorkers);
     
     // Setup camera
     m_camera.target = m_player->GetPosition();
@@ -44,29 +86,84 @@ void Game::Init() {
 }
 
 void Game::Run() {
+    const float step = GetFixedStep();
+    
     while (m_running && !WindowShouldClose()) {
-        m_deltaTime = GetFrameTime();
+        Profiler::Instance().NewFrame();
+        PathRequestQueue::Instance().BeginFrame();
+        m_accumulator += GetFrameTime();
+        SpriteManager::Instance().UpdateStreaming();
+        TextCache::Instance().NewFrame();
+        
+        // Steps read presses latched from this frame; UI drawn in Render()
+        // keeps reading the raw provider
+        IInputProvider& frameInput = Input::GetProvider();
+        m_tickInput.Poll(frameInput);
+        Input::SetProvider(&m_tickInput);
+        
+        int steps = 0;
+        while (m_accumulator >= step && steps < m_config.maxCatchUpSteps) {
+            Tick(step);
+            m_tickInput.ConsumePressed();
+            m_accumulator -= step;
+            ++steps;
+        }
         
-        HandleInput();
-        Update();
+        Input::SetProvider(&frameInput);
+        
+        // Still behind after the cap (hitch, breakpoint, window drag):
+        // drop the backlog rather than run ever more steps next frame
+        if (m_accumulator >= step) {
+            m_accumulator = fmodf(m_accumulator, step);
+        }
+        
+        // Outside of play nothing moves between steps, so draw the latest state
+        m_interpolationAlpha = (m_state == GameState::PLAYING) ? m_accumulator / step : 1.0f;
         Render();
+        
+        if (!m_firstFrameLogged) {
+            m_firstFrameLogged = true;
+            float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_initStart).count();
+            TraceLog(LOG_INFO, "Game: First frame after %.1f ms%s", ms,
+                     SpriteManager::Instance().IsStreaming() ? " (sprites still streaming)" : "");
+        }
     }
 }
 
+void Game::Tick(float dt) {
+    m_deltaTime = dt;
+    
+    HandleInput();
+    Update();
+}
+
 void Game::Shutdown() {
+    // Workers may be reading rooms; stop them before anything is torn down
+    PathRequestQueue::Instance().Stop();
+    JobSystem::Instance().Stop();
+    
+    if (m_config.tracePath) {
+        SaveProfilerTrace();
+    }
+    
     m_player.reset();
     m_dungeon.reset();
     m_enemies.reset();
     m_projectiles.reset();
     m_ui.reset();
+    m_enemyGrid.reset();
     
-    // Shutdown sprite manager
-    SpriteManager::Instance().Shutdown();
-    
-    CloseWindow();
+    if (!m_config.headless) {
+        // Shutdown sprite manager
+        SpriteManager::Instance().Shutdown();
+        
+        CloseWindow();
+    }
 }
 
 void Game::Update() {
+    PROFILE_SCOPE("Game::Update");
+    
     // Update sprite animations
     SpriteManager::Instance().Update(m_deltaTime);
     
@@ -84,6 +181,7 @@ void Game::Update() {
             break;
             
         case GameState::PLAYING:
+            m_player->StorePreviousPosition();
             m_player->Update(m_deltaTime);
             m_dungeon->Update(m_deltaTime);
             m_enemies->Update(m_deltaTime);
@@ -162,6 +260,8 @@ void Game::Update() {
 }
 
 void Game::Render() {
+    PROFILE_SCOPE("Game::Render");
+    
     BeginDrawing();
     ClearBackground(Color{20, 20, 30, 255});
     
@@ -180,12 +280,22 @@ void Game::Render() {
             
         case GameState::PLAYING:
         case GameState::PAUSED:
+            m_camera.target = m_player->GetRenderPosition(m_interpolationAlpha);
+            m_dungeon->PrepareRender();
             BeginMode2D(m_camera);
             
-            m_dungeon->Render();
-            m_player->Render();
-            m_enemies->Render();
-            m_projectiles->Render();
+            // Dungeon draws directly (tiles are one cached quad); entities
+            // go through the queue so they batch by layer and texture. Only
+            // what overlaps the camera view is submitted.
+            {
+                Rectangle view = GetCameraView();
+                bool gridCurrent = m_enemyGridVersion == m_enemies->GetRosterVersion();
+                m_dungeon->Render(view);
+                m_player->Render();
+                m_enemies->Render(view, gridCurrent ? m_enemyGrid.get() : nullptr);
+                m_projectiles->Render(view);
+            }
+            RenderQueue::Instance().Flush();
             
             EndMode2D();
             
@@ -209,9 +319,11 @@ void Game::Render() {
             
         case GameState::FLOOR_CLEAR:
             // Render game world behind buff selection
+            m_dungeon->PrepareRender();
             BeginMode2D(m_camera);
-            m_dungeon->Render();
+            m_dungeon->Render(GetCameraView());
             m_player->Render();
+            RenderQueue::Instance().Flush();
             EndMode2D();
             // Render floor buff selection overlay
             m_ui->RenderFloorBuffSelection(m_startingBuffs);
@@ -223,9 +335,49 @@ void Game::Render() {
         m_ui->RenderDebugMenu();
     }
     
+    if (Profiler::Instance().IsOverlayVisible()) {
+        m_ui->RenderProfilerOverlay();
+    }
+    
     EndDrawing();
 }
 
+Rectangle Game::GetCameraView() const {
+    // Bounds of the four screen corners, so zoom and rotation both work
+    const Vector2 corners[4] = {
+        {0.0f, 0.0f},
+        {static_cast<float>(SCREEN_WIDTH), 0.0f},
+        {0.0f, static_cast<float>(SCREEN_HEIGHT)},
+        {static_cast<float>(SCREEN_WIDTH), static_cast<float>(SCREEN_HEIGHT)}
+    };
+    
+    Vector2 minCorner = GetScreenToWorld2D(corners[0], m_camera);
+    Vector2 maxCorner = minCorner;
+    for (int i = 1; i < 4; ++i) {
+        Vector2 world = GetScreenToWorld2D(corners[i], m_camera);
+        minCorner = {std::min(minCorner.x, world.x), std::min(minCorner.y, world.y)};
+        maxCorner = {std::max(maxCorner.x, world.x), std::max(maxCorner.y, world.y)};
+    }
+    
+    return {
+        minCorner.x - VIEW_MARGIN,
+        minCorner.y - VIEW_MARGIN,
+        maxCorner.x - minCorner.x + 2.0f * VIEW_MARGIN,
+        maxCorner.y - minCorner.y + 2.0f * VIEW_MARGIN
+    };
+}
+
+void Game::SaveProfilerTrace() {
+    const char* path = m_config.tracePath ? m_config.tracePath : "epitome_trace.json";
+    if (!Profiler::IsCompiledIn()) {
+        TraceLog(LOG_WARNING, "Profiler: Built without EPITOME_ENABLE_PROFILER, no trace written");
+    } else if (Profiler::Instance().WriteChromeTrace(path)) {
+        TraceLog(LOG_INFO, "Profiler: Trace written to %s", path);
+    } else {
+        TraceLog(LOG_WARNING, "Profiler: Could not write trace to %s", path);
+    }
+}
+
 void Game::HandleInput() {
     // Reset input block at start of frame
     if (m_blockInputThisFrame) {
@@ -234,10 +386,22 @@ void Game::HandleInput() {
     }
     
     // Debug menu toggle (I) - available in most states
-    if (IsKeyPressed(KEY_I)) {
+    if (Input::IsKeyPressed(KEY_I)) {
         ToggleDebugMenu();
     }
     
+    // Profiler trace dump (F9)
+    if (Input::IsKeyPressed(KEY_F9)) {
+        SaveProfilerTrace();
+    }
+    
+    // Instanced vs. primitive projectile drawing (F10), for comparing in the profiler
+    if (Input::IsKeyPressed(KEY_F10)) {
+        bool instanced = !m_projectiles->IsInstancingEnabled();
+        m_projectiles->SetInstancingEnabled(instanced);
+        TraceLog(LOG_INFO, "Game: Instanced projectiles %s", instanced ? "on" : "off");
+    }
+    
     // If debug menu is open, don't process other input
     if (m_debugMenuOpen) {
         return;
@@ -245,7 +409,7 @@ void Game::HandleInput() {
     
     switch (m_state) {
         case GameState::MENU:
-            if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE)) {
+            if (Input::IsKeyPressed(KEY_ENTER) || Input::IsKeyPressed(KEY_SPACE)) {
                 // Go to hub instead of directly to buff selection
                 m_state = GameState::HUB;
             }
@@ -260,35 +424,35 @@ void Game::HandleInput() {
             break;
             
         case GameState::PLAYING:
-            if (IsKeyPressed(KEY_ESCAPE)) {
+            if (Input::IsKeyPressed(KEY_ESCAPE)) {
                 m_state = GameState::PAUSED;
             }
             
             // Shooting (skip if input blocked this frame)
-            if (!m_blockInputThisFrame && IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
+            if (!m_blockInputThisFrame && Input::IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
                 m_player->Shoot();
             }
             
             // Ability
-            if (!m_blockInputThisFrame && (IsKeyPressed(KEY_SPACE) || IsMouseButtonPressed(MOUSE_BUTTON_RIGHT))) {
+            if (!m_blockInputThisFrame && (Input::IsKeyPressed(KEY_SPACE) || Input::IsMouseButtonPressed(MOUSE_BUTTON_RIGHT))) {
                 m_player->UseAbility();
             }
             break;
             
         case GameState::PAUSED:
-            if (IsKeyPressed(KEY_ESCAPE)) {
+            if (Input::IsKeyPressed(KEY_ESCAPE)) {
                 m_state = GameState::PLAYING;
             }
             break;
             
         case GameState::GAME_OVER:
-            if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE)) {
+            if (Input::IsKeyPressed(KEY_ENTER) || Input::IsKeyPressed(KEY_SPACE)) {
                 m_state = GameState::MENU;
             }
             break;
             
         case GameState::RUN_RESULTS:
-            if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE)) {
+            if (Input::IsKeyPressed(KEY_ENTER) || Input::IsKeyPressed(KEY_SPACE)) {
                 ReturnToHub();
             }
             break;
@@ -308,7 +472,7 @@ void Game::StartNewGame() {
     m_currentSubLevel = 1;
     
     // Generate first level (1-1)
-    unsigned int seed = static_cast<unsigned int>(time(nullptr));
+    unsigned int seed = NextDungeonSeed();
     m_dungeon->Generate(seed, m_currentStage, m_currentSubLevel);
     
     // Place player at start room spawn point
@@ -336,7 +500,7 @@ void Game::PrepareNewGame() {
     m_currentSubLevel = 1;
     
     // Generate first dungeon
-    unsigned int seed = static_cast<unsigned int>(time(nullptr));
+    unsigned int seed = NextDungeonSeed();
     m_dungeon->Generate(seed, m_currentStage, m_currentSubLevel);
     
     // Generate 3 random starting buffs
@@ -369,52 +533,71 @@ void Game::StartGameWithBuff(int buffIndex) {
 }
 
 void Game::CheckCollisions() {
-    auto& projectiles = m_projectiles->GetProjectiles();
-    auto& enemies = m_enemies->GetEnemies();
+    PROFILE_SCOPE("Game::CheckCollisions");
+    
+    ProjectileManager& projectiles = *m_projectiles;
+    EnemyManager& enemies = *m_enemies;
     
-    for (auto& proj : projectiles) {
-        if (!proj.IsActive()) continue;
+    // Broadphase: bin living enemies by tile-sized cell
+    m_enemyGrid->Clear();
+    const int enemyCount = enemies.GetCount();
+    for (int i = 0; i < enemyCount; ++i) {
+        if (enemies.IsDead(i)) continue;
+        m_enemyGrid->Insert(i, enemies.GetPosition(i), enemies.GetRadius(i));
+    }
+    m_enemyGrid->Build();
+    m_enemyGridVersion = m_enemies->GetRosterVersion();
+    
+    auto overlaps = [](Vector2 a, float ra, Vector2 b, float rb) {
+        float reach = ra + rb;
+        return Vector2DistanceSqr(a, b) < reach * reach;
+    };
+    
+    const int projectileCount = projectiles.GetCount();
+    for (int p = 0; p < projectileCount; ++p) {
+        if (!projectiles.IsActive(p)) continue;
         
-        if (proj.IsPlayerOwned()) {
-            // Check against enemies
-            for (auto& enemy : enemies) {
-                if (!enemy || enemy->IsDead()) continue;
+        Vector2 projPos = projectiles.GetPosition(p);
+        float projRadius = projectiles.GetRadius(p);
+        
+        if (projectiles.IsPlayerOwned(p)) {
+            // Check against nearby enemies; the lowest index wins so hits
+            // resolve in the same order as a full scan would
+            int hitIndex = -1;
+            m_enemyGrid->ForEachCandidate(projPos, projRadius, [&](int index) {
+                if (hitIndex != -1 && index > hitIndex) return;
+                if (enemies.IsDead(index)) return;
+                if (overlaps(projPos, projRadius, enemies.GetPosition(index), enemies.GetRadius(index))) {
+                    hitIndex = index;
+                }
+            });
+            
+            if (hitIndex != -1) {
+                enemies.TakeDamage(hitIndex, projectiles.GetDamage(p));
+                if (!projectiles.IsPiercing(p)) {
+                    projectiles.MarkForDestroy(p);
+                }
                 
-                if (proj.CollidesWith(*enemy)) {
-                    enemy->TakeDamage(proj.GetDamage());
-                    if (!proj.IsPiercing()) {
-                        proj.MarkForDestroy();
-                    }
-                    
-                    // Drop currency if enemy died
-                    if (enemy->IsDead()) {
-                        m_player->AddRunCurrency(enemy->GetData().currencyDrop);
-                    }
-                    break;
+                // Drop currency if enemy died
+                if (enemies.IsDead(hitIndex)) {
+                    m_player->AddRunCurrency(enemies.GetData(hitIndex).currencyDrop);
                 }
             }
         } else {
             // Enemy projectile, check against player
-            if (proj.CollidesWith(*m_player)) {
-                m_player->TakeDamage(proj.GetDamage());
-                proj.MarkForDestroy();
+            if (overlaps(projPos, projRadius, m_player->GetPosition(), m_player->GetRadius())) {
+                m_player->TakeDamage(projectiles.GetDamage(p));
+                projectiles.MarkForDestroy(p);
             }
         }
         
         // Check wall collision
-        if (!m_dungeon->IsWalkable(proj.GetPosition())) {
-            proj.MarkForDestroy();
+        if (!m_dungeon->IsWalkable(projPos)) {
+            projectiles.MarkForDestroy(p);
         }
     }
     
-    // Check enemy melee collision with player
-    for (auto& enemy : enemies) {
-        if (!enemy || enemy->IsDead()) continue;
-        
-        if (enemy->CollidesWith(*m_player)) {
-            // Melee damage handled in enemy AI
-        }
-    }
+    // Enemy melee damage is dealt in the enemy AI (EnemyManager::Attack)
     
     // Check door collision
     int roomId, direction;
@@ -447,7 +630,7 @@ void Game::NextLevel() {
         m_currentSubLevel = 1;
     }
     
-    unsigned int seed = static_cast<unsigned int>(time(nullptr));
+    unsigned int seed = NextDungeonSeed();
     m_dungeon->Generate(seed, m_currentStage, m_currentSubLevel);
     
     if (m_dungeon->GetCurrentRoom()) {
@@ -461,6 +644,15 @@ void Game::NextLevel() {
     m_state = GameState::PLAYING;
 }
 
+unsigned int Game::NextDungeonSeed() {
+    // Fixed seeds give reproducible runs (one distinct floor per generation)
+    unsigned int floorIndex = m_floorsGenerated++;
+    if (m_config.seed != 0) {
+        return m_config.seed + floorIndex * 7919u;
+    }
+    return static_cast<unsigned int>(time(nullptr)) + floorIndex;
+}
+
 void Game::ShowBuffSelection() {
     m_startingBuffs = Player::GetRandomBuffs(3);
     m_isFloorBuffSelection = false;
@@ -517,7 +709,7 @@ void Game::CheckPortalEntry() {
         }
         
         // Generate new level
-        unsigned int seed = static_cast<unsigned int>(time(nullptr));
+        unsigned int seed = NextDungeonSeed();
         m_dungeon->Generate(seed, m_currentStage, m_currentSubLevel);
         
         // Show floor buff selection (different from starting buffs)
@@ -0,0 +1,74 @@
+#include "Input.hpp"
+
+// ============================================================================
+// Scripted Input Provider Implementation
+// ============================================================================
+void ScriptedInputProvider::SetKeyDown(int key, bool down) {
+    if (down) {
+        m_keysDown.insert(key);
+    } else {
+        m_keysDown.erase(key);
+    }
+}
+
+void ScriptedInputProvider::PressKey(int key) {
+    m_keysPressed.insert(key);
+}
+
+void ScriptedInputProvider::SetMouseButtonDown(int button, bool down) {
+    if (down) {
+        m_buttonsDown.insert(button);
+    } else {
+        m_buttonsDown.erase(button);
+    }
+}
+
+void ScriptedInputProvider::PressMouseButton(int button) {
+    m_buttonsPressed.insert(button);
+}
+
+void ScriptedInputProvider::ReleaseAll() {
+    m_keysDown.clear();
+    m_buttonsDown.clear();
+}
+
+void ScriptedInputProvider::EndFrame() {
+    m_keysPressed.clear();
+    m_buttonsPressed.clear();
+}
+
+// ============================================================================
+// Latched Input Provider Implementation
+// ============================================================================
+void LatchedInputProvider::Poll(IInputProvider& source) {
+    m_source = &source;
+    for (int key = 0; key < MAX_KEYS; ++key) {
+        if (source.IsKeyPressed(key)) m_keysPressed.set(key);
+    }
+    for (int button = 0; button < MAX_MOUSE_BUTTONS; ++button) {
+        if (source.IsMouseButtonPressed(button)) m_buttonsPressed.set(button);
+    }
+}
+
+void LatchedInputProvider::ConsumePressed() {
+    m_keysPressed.reset();
+    m_buttonsPressed.reset();
+}
+
+// ============================================================================
+// Input Access
+// ============================================================================
+namespace {
+    RaylibInputProvider s_raylibProvider;
+    IInputProvider* s_activeProvider = &s_raylibProvider;
+}
+
+namespace Input {
+    void SetProvider(IInputProvider* provider) {
+        s_activeProvider = provider ? provider : &s_raylibProvider;
+    }
+
+    IInputProvider& GetProvider() {
+        return *s_activeProvider;
+    }
+}
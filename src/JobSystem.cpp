@@ -0,0 +1,150 @@
+#include "JobSystem.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+
+JobSystem& JobSystem::Instance() {
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::~JobSystem() {
+    Stop();
+}
+
+void JobSystem::Start(int workerCount) {
+    Stop();
+
+    m_stopping = false;
+    for (int i = 0; i < workerCount + 1; ++i) {
+        m_queues.push_back(std::make_unique<Queue>());
+    }
+    for (int i = 1; i <= workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+}
+
+void JobSystem::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+    m_queues.clear();
+}
+
+int JobSystem::GetChunkCount(int count, int grainSize) {
+    if (count <= 0) return 0;
+    grainSize = std::max(grainSize, 1);
+    return (count + grainSize - 1) / grainSize;
+}
+
+int JobSystem::ParallelFor(int count, int grainSize, const RangeFn& fn) {
+    grainSize = std::max(grainSize, 1);
+    const int chunks = GetChunkCount(count, grainSize);
+    m_stealsLastRun = 0;
+
+    if (m_workers.empty() || chunks <= 1) {
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+            int begin = chunk * grainSize;
+            fn(begin, std::min(begin + grainSize, count), chunk);
+        }
+        return chunks;
+    }
+
+    m_fn = &fn;
+    m_count = count;
+    m_grain = grainSize;
+    m_steals.store(0);
+    m_remaining.store(chunks);
+
+    // Contiguous blocks keep neighbouring chunks on one thread until someone
+    // runs out and steals
+    const int threads = static_cast<int>(m_queues.size());
+    for (int q = 0; q < threads; ++q) {
+        Queue& queue = *m_queues[q];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        for (int chunk = q * chunks / threads; chunk < (q + 1) * chunks / threads; ++chunk) {
+            queue.chunks.push_back(chunk);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_generation;
+    }
+    m_workAvailable.notify_all();
+
+    while (RunOne(0)) {}
+
+    // Chunks stolen from us may still be running
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_workFinished.wait(lock, [this] { return m_remaining.load() == 0; });
+    }
+
+    m_fn = nullptr;
+    m_stealsLastRun = m_steals.load();
+    return chunks;
+}
+
+bool JobSystem::RunOne(int index) {
+    int chunk = -1;
+
+    {
+        Queue& own = *m_queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.chunks.empty()) {
+            chunk = own.chunks.front();
+            own.chunks.pop_front();
+        }
+    }
+
+    // Steal from the far end of someone else's block
+    const int threads = static_cast<int>(m_queues.size());
+    for (int offset = 1; chunk < 0 && offset < threads; ++offset) {
+        Queue& victim = *m_queues[(index + offset) % threads];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.chunks.empty()) {
+            chunk = victim.chunks.back();
+            victim.chunks.pop_back();
+            m_steals.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (chunk < 0) return false;
+
+    int begin = chunk * m_grain;
+    (*m_fn)(begin, std::min(begin + m_grain, m_count), chunk);
+
+    if (m_remaining.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_workFinished.notify_all();
+    }
+    return true;
+}
+
+void JobSystem::WorkerLoop(int index) {
+    Profiler::Instance().SetThreadName("JobWorker");
+
+    uint64_t seen;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        seen = m_generation;
+    }
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_workAvailable.wait(lock, [this, seen] { return m_stopping || m_generation != seen; });
+            if (m_stopping) return;
+            seen = m_generation;
+        }
+
+        while (RunOne(index)) {}
+    }
+}
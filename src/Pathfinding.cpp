@@ -1,9 +1,12 @@
 #include "Pathfinding.hpp"
 #include "Dungeon.hpp"
+#include "Profiler.hpp"
 #include "raymath.h"
 #include <cmath>
 #include <algorithm>
 #include <functional>
+#include <chrono>
+#include <climits>
 #include <random>
 
 // ============================================================================
@@ -104,6 +107,79 @@ void AlternativePathModifier::Apply(Path& path) {
     }
 }
 
+// ============================================================================
+// Path Search Context Implementation
+// ============================================================================
+void PathSearchContext::Begin(int nodeCount) {
+    if (static_cast<int>(m_nodes.size()) != nodeCount) {
+        m_nodes.assign(nodeCount, SearchNode{0.0f, 0.0f, -1, -1, 0, false});
+        m_heap.reserve(nodeCount);
+        m_generation = 0;
+    }
+    if (++m_generation == 0) {
+        // Wrapped - stamp everything stale explicitly once every 2^32 queries
+        for (SearchNode& node : m_nodes) node.generation = 0;
+        m_generation = 1;
+    }
+    m_heap.clear();
+}
+
+// Indexed binary heap on fCost. Each queued node knows its heap slot, so an
+// improved gCost is a sift-up in place instead of a duplicate entry.
+void PathSearchContext::HeapPush(int node) {
+    m_nodes[node].heapIndex = static_cast<int>(m_heap.size());
+    m_heap.push_back(node);
+    HeapSiftUp(m_nodes[node].heapIndex);
+}
+
+int PathSearchContext::HeapPop() {
+    int top = m_heap[0];
+    m_nodes[top].heapIndex = -1;
+    
+    int last = m_heap.back();
+    m_heap.pop_back();
+    if (!m_heap.empty()) {
+        m_heap[0] = last;
+        m_nodes[last].heapIndex = 0;
+        HeapSiftDown(0);
+    }
+    return top;
+}
+
+void PathSearchContext::HeapSiftUp(int pos) {
+    int node = m_heap[pos];
+    float f = m_nodes[node].fCost;
+    while (pos > 0) {
+        int parentPos = (pos - 1) / 2;
+        int parent = m_heap[parentPos];
+        if (m_nodes[parent].fCost <= f) break;
+        m_heap[pos] = parent;
+        m_nodes[parent].heapIndex = pos;
+        pos = parentPos;
+    }
+    m_heap[pos] = node;
+    m_nodes[node].heapIndex = pos;
+}
+
+void PathSearchContext::HeapSiftDown(int pos) {
+    int count = static_cast<int>(m_heap.size());
+    int node = m_heap[pos];
+    float f = m_nodes[node].fCost;
+    while (true) {
+        int child = pos * 2 + 1;
+        if (child >= count) break;
+        if (child + 1 < count && m_nodes[m_heap[child + 1]].fCost < m_nodes[m_heap[child]].fCost) {
+            ++child;
+        }
+        if (m_nodes[m_heap[child]].fCost >= f) break;
+        m_heap[pos] = m_heap[child];
+        m_nodes[m_heap[pos]].heapIndex = pos;
+        pos = child;
+    }
+    m_heap[pos] = node;
+    m_nodes[node].heapIndex = pos;
+}
+
 // ============================================================================
 // Pathfinder Implementation
 // ============================================================================
@@ -119,188 +195,167 @@ float Pathfinder::Heuristic(int x1, int y1, int x2, int y2) const {
     return std::sqrt(dx * dx + dy * dy) * config.heuristicScale;
 }
 
-std::vector<std::pair<int, int>> Pathfinder::GetNeighbors(Room* room, int x, int y) const {
-    std::vector<std::pair<int, int>> neighbors;
-    
-    ITraversalProvider* traversal = config.traversalProvider ? 
-        config.traversalProvider : const_cast<DefaultTraversalProvider*>(&m_defaultTraversal);
-    
-    if (config.allowDiagonal) {
-        // 8-directional movement
-        const int dx[] = {-1, 0, 1, -1, 1, -1, 0, 1};
-        const int dy[] = {-1, -1, -1, 0, 0, 1, 1, 1};
-        
-        for (int i = 0; i < 8; ++i) {
-            int nx = x + dx[i];
-            int ny = y + dy[i];
-            
-            if (traversal->CanTraverse(room, nx, ny)) {
-                // For diagonal movement, check corner cutting
-                if (dx[i] != 0 && dy[i] != 0 && !config.cutCorners) {
-                    if (!traversal->CanTraverse(room, x + dx[i], y) || 
-                        !traversal->CanTraverse(room, x, y + dy[i])) {
-                        continue;  // Can't cut corner
-                    }
-                }
-                neighbors.push_back({nx, ny});
-            }
-        }
-    } else {
-        // 4-directional movement
-        const int dx[] = {-1, 0, 1, 0};
-        const int dy[] = {0, -1, 0, 1};
-        
-        for (int i = 0; i < 4; ++i) {
-            int nx = x + dx[i];
-            int ny = y + dy[i];
-            
-            if (traversal->CanTraverse(room, nx, ny)) {
-                neighbors.push_back({nx, ny});
-            }
-        }
-    }
+Path Pathfinder::FindPath(Room* room, Vector2 startWorld, Vector2 goalWorld) {
+    Path result;
+    FindPath(room, startWorld, goalWorld, result);
+    return result;
+}
+
+bool Pathfinder::FindPath(Room* room, Vector2 startWorld, Vector2 goalWorld, Path& result) {
+    PROFILE_SCOPE("Pathfinder::FindPath");
     
-    return neighbors;
+    if (!Search(room, startWorld, goalWorld, result, m_context)) return false;
+    ApplyModifiers(result);
+    return true;
 }
 
-Path Pathfinder::FindPath(Room* room, Vector2 startWorld, Vector2 goalWorld) {
-    Path result;
+bool Pathfinder::Search(Room* room, Vector2 startWorld, Vector2 goalWorld, Path& result,
+                        PathSearchContext& context) const {
+    result.vectorPath.clear();
+    result.error = false;
+    result.errorMessage = "";
     
-    if (!room) {
+    auto fail = [&result](const char* message) {
         result.error = true;
-        result.errorMessage = "No room provided";
-        return result;
+        result.errorMessage = message;
+        return false;
+    };
+    
+    if (!room) {
+        return fail("No room provided");
     }
     
-    // Get traversal provider
-    ITraversalProvider* traversal = config.traversalProvider ? 
-        config.traversalProvider : const_cast<DefaultTraversalProvider*>(&m_defaultTraversal);
+    // Get traversal provider. Without a custom one, read the room's
+    // walkability bits directly instead of going through a virtual call.
+    const ITraversalProvider* traversal = config.traversalProvider;
+    auto canTraverse = [room, traversal](int x, int y) {
+        return traversal ? traversal->CanTraverse(room, x, y) : room->IsWalkable(x, y);
+    };
     
     // Convert world positions to tile coordinates
     int startX, startY, goalX, goalY;
     if (!room->WorldToTile(startWorld, startX, startY)) {
-        result.error = true;
-        result.errorMessage = "Start position outside room";
-        return result;
+        return fail("Start position outside room");
     }
     if (!room->WorldToTile(goalWorld, goalX, goalY)) {
-        result.error = true;
-        result.errorMessage = "Goal position outside room";
-        return result;
+        return fail("Goal position outside room");
     }
     
     // Check walkability
-    if (!traversal->CanTraverse(room, startX, startY)) {
-        result.error = true;
-        result.errorMessage = "Start position not walkable";
-        return result;
+    if (!canTraverse(startX, startY)) {
+        return fail("Start position not walkable");
     }
-    if (!traversal->CanTraverse(room, goalX, goalY)) {
-        result.error = true;
-        result.errorMessage = "Goal position not walkable";
-        return result;
+    if (!canTraverse(goalX, goalY)) {
+        return fail("Goal position not walkable");
     }
     
     // Already at goal
     if (startX == goalX && startY == goalY) {
-        return result;  // Empty path, no error
+        return true;  // Empty path, no error
     }
     
-    // A* implementation
-    auto hashCoord = [](int x, int y) { return y * 10000 + x; };
+    // Search arrays are sized once; a new generation makes every node stale
+    // so nothing has to be cleared between queries
+    const int width = Room::WIDTH;
+    context.Begin(Room::WIDTH * Room::HEIGHT);
+    std::vector<PathSearchContext::SearchNode>& nodes = context.m_nodes;
+    const uint32_t generation = context.m_generation;
     
-    std::priority_queue<PathNode, std::vector<PathNode>, std::greater<PathNode>> openSet;
-    std::unordered_map<int, PathNode> allNodes;
-    std::unordered_map<int, bool> closedSet;
+    const int startIndex = startY * width + startX;
+    const int goalIndex = goalY * width + goalX;
     
-    PathNode startNode;
-    startNode.x = startX;
-    startNode.y = startY;
-    startNode.gCost = 0;
-    startNode.hCost = Heuristic(startX, startY, goalX, goalY);
-    startNode.parentX = -1;
-    startNode.parentY = -1;
+    PathSearchContext::SearchNode& startNode = nodes[startIndex];
+    startNode.gCost = 0.0f;
+    startNode.fCost = Heuristic(startX, startY, goalX, goalY);
+    startNode.parent = -1;
+    startNode.generation = generation;
+    startNode.closed = false;
+    context.HeapPush(startIndex);
     
-    openSet.push(startNode);
-    allNodes[hashCoord(startX, startY)] = startNode;
+    const int dirCount = config.allowDiagonal ? 8 : 4;
+    const int dx[] = {-1, 0, 1, 0, -1, 1, -1, 1};
+    const int dy[] = {0, -1, 0, 1, -1, -1, 1, 1};
     
     int iterations = 0;
     
-    while (!openSet.empty() && iterations < config.maxIterations) {
+    while (!context.m_heap.empty() && iterations < config.maxIterations) {
         ++iterations;
         
-        PathNode current = openSet.top();
-        openSet.pop();
-        
-        int currentHash = hashCoord(current.x, current.y);
-        
-        // Skip if already processed
-        if (closedSet[currentHash]) continue;
-        closedSet[currentHash] = true;
+        int currentIndex = context.HeapPop();
+        PathSearchContext::SearchNode& current = nodes[currentIndex];
+        current.closed = true;
         
         // Found the goal
-        if (current.x == goalX && current.y == goalY) {
-            // Reconstruct path
-            std::vector<Vector2> reversePath;
-            int cx = current.x;
-            int cy = current.y;
-            
-            while (cx != -1 && cy != -1) {
-                reversePath.push_back(room->TileToWorld(cx, cy));
-                int hash = hashCoord(cx, cy);
-                int px = allNodes[hash].parentX;
-                int py = allNodes[hash].parentY;
-                cx = px;
-                cy = py;
-            }
-            
-            // Reverse path, skipping start position
-            for (int i = static_cast<int>(reversePath.size()) - 2; i >= 0; --i) {
-                result.vectorPath.push_back(reversePath[i]);
+        if (currentIndex == goalIndex) {
+            // Count waypoints (start excluded), then fill back to front
+            int length = 0;
+            for (int i = goalIndex; nodes[i].parent != -1; i = nodes[i].parent) {
+                ++length;
             }
             
-            // Apply modifiers
-            for (auto& modifier : m_modifiers) {
-                modifier->Apply(result);
+            result.vectorPath.resize(length);
+            int slot = length - 1;
+            for (int i = goalIndex; nodes[i].parent != -1; i = nodes[i].parent) {
+                result.vectorPath[slot--] = room->TileToWorld(i % width, i / width);
             }
             
-            return result;
+            return true;
         }
         
-        // Explore neighbors
-        for (auto& [nx, ny] : GetNeighbors(room, current.x, current.y)) {
-            int neighborHash = hashCoord(nx, ny);
+        int cx = currentIndex % width;
+        int cy = currentIndex / width;
+        
+        // Explore neighbors (cardinals first, then diagonals)
+        for (int d = 0; d < dirCount; ++d) {
+            int nx = cx + dx[d];
+            int ny = cy + dy[d];
+            
+            if (!canTraverse(nx, ny)) continue;
+            
+            // For diagonal movement, check corner cutting
+            bool diagonal = d >= 4;
+            if (diagonal && !config.cutCorners) {
+                if (!canTraverse(nx, cy) || !canTraverse(cx, ny)) {
+                    continue;  // Can't cut corner
+                }
+            }
+            
+            int neighborIndex = ny * width + nx;
+            PathSearchContext::SearchNode& neighbor = nodes[neighborIndex];
+            bool fresh = neighbor.generation != generation;
             
-            if (closedSet[neighborHash]) continue;
+            if (!fresh && neighbor.closed) continue;
             
             // Base cost: 1.0 for cardinal, 1.414 for diagonal
-            float baseCost = (nx != current.x && ny != current.y) ? 1.414f : 1.0f;
+            float baseCost = diagonal ? 1.414f : 1.0f;
             
             // Apply traversal cost
-            float traversalCost = traversal->GetTraversalCost(room, nx, ny);
+            float traversalCost = traversal ? traversal->GetTraversalCost(room, nx, ny) : 1.0f;
             float newGCost = current.gCost + baseCost * traversalCost;
             
-            auto it = allNodes.find(neighborHash);
-            if (it == allNodes.end() || newGCost < it->second.gCost) {
-                PathNode neighbor;
-                neighbor.x = nx;
-                neighbor.y = ny;
-                neighbor.gCost = newGCost;
-                neighbor.hCost = Heuristic(nx, ny, goalX, goalY);
-                neighbor.parentX = current.x;
-                neighbor.parentY = current.y;
-                
-                allNodes[neighborHash] = neighbor;
-                openSet.push(neighbor);
+            if (fresh) {
+                neighbor.generation = generation;
+                neighbor.closed = false;
+                neighbor.heapIndex = -1;
+            } else if (newGCost >= neighbor.gCost) {
+                continue;
+            }
+            
+            neighbor.gCost = newGCost;
+            neighbor.fCost = newGCost + Heuristic(nx, ny, goalX, goalY);
+            neighbor.parent = currentIndex;
+            
+            if (neighbor.heapIndex == -1) {
+                context.HeapPush(neighborIndex);
+            } else {
+                context.HeapSiftUp(neighbor.heapIndex);
             }
         }
     }
     
     // No path found
-    result.error = true;
-    result.errorMessage = iterations >= config.maxIterations ? 
-        "Max iterations reached" : "No path exists";
-    return result;
+    return fail(iterations >= config.maxIterations ? 
+        "Max iterations reached" : "No path exists");
 }
 
 std::vector<Vector2> Pathfinder::FindPathStatic(Room* room, Vector2 startWorld, Vector2 goalWorld) {
@@ -333,23 +388,414 @@ void Pathfinder::ClearModifiers() {
     m_modifiers.clear();
 }
 
+void Pathfinder::ApplyModifiers(Path& path) {
+    if (path.error) return;
+    for (auto& modifier : m_modifiers) {
+        modifier->Apply(path);
+    }
+}
+
+// ============================================================================
+// Flow Field Implementation
+// ============================================================================
+bool FlowField::Update(Room* room, Vector2 goalWorld) {
+    if (!room) {
+        Invalidate();
+        return false;
+    }
+    
+    m_goalWorld = goalWorld;
+    
+    int goalX, goalY;
+    if (!room->WorldToTile(goalWorld, goalX, goalY)) {
+        goalX = -1;
+        goalY = -1;
+    }
+    
+    if (room == m_room && room->GetId() == m_roomId && goalX == m_goalX && goalY == m_goalY) {
+        return false;
+    }
+    
+    m_room = room;
+    m_roomId = room->GetId();
+    m_goalX = goalX;
+    m_goalY = goalY;
+    Build();
+    return true;
+}
+
+void FlowField::Invalidate() {
+    m_room = nullptr;
+    m_roomId = -1;
+    m_goalX = -1;
+    m_goalY = -1;
+    m_goalReachable = false;
+}
+
+void FlowField::Build() {
+    ++m_rebuildCount;
+    
+    const int width = Room::WIDTH;
+    const int height = Room::HEIGHT;
+    const float unreached = -1.0f;
+    
+    m_integration.assign(width * height, unreached);
+    m_next.assign(width * height, -1);
+    
+    const PathfinderConfig& config = Pathfinder::Instance().config;
+    DefaultTraversalProvider defaultTraversal;
+    const ITraversalProvider* traversal = config.traversalProvider ? 
+        config.traversalProvider : &defaultTraversal;
+    
+    m_goalReachable = m_goalX >= 0 && traversal->CanTraverse(m_room, m_goalX, m_goalY);
+    if (!m_goalReachable) return;
+    
+    const int dirCount = config.allowDiagonal ? 8 : 4;
+    const int dx8[] = {-1, 0, 1, 0, -1, 1, -1, 1};
+    const int dy8[] = {0, -1, 0, 1, -1, -1, 1, 1};
+    
+    // Moves are symmetric, so walking outward from the goal gives every
+    // tile's cost *to* the goal
+    auto canStep = [&](int x, int y, int d) {
+        int nx = x + dx8[d];
+        int ny = y + dy8[d];
+        if (!traversal->CanTraverse(m_room, nx, ny)) return false;
+        if (d >= 4 && !config.cutCorners) {
+            if (!traversal->CanTraverse(m_room, nx, y) || 
+                !traversal->CanTraverse(m_room, x, ny)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    
+    // Dijkstra integration field. The heap's storage is reused, so rebuilds
+    // (every time the player changes tile) don't allocate once it has grown
+    using Entry = std::pair<float, int>;
+    const std::greater<Entry> minHeap;
+    m_open.clear();
+    m_open.reserve(width * height);
+    
+    int goalIndex = m_goalY * width + m_goalX;
+    m_integration[goalIndex] = 0.0f;
+    m_open.push_back({0.0f, goalIndex});
+    
+    while (!m_open.empty()) {
+        std::pop_heap(m_open.begin(), m_open.end(), minHeap);
+        auto [cost, index] = m_open.back();
+        m_open.pop_back();
+        if (cost > m_integration[index]) continue;  // Stale entry
+        
+        int x = index % width;
+        int y = index / width;
+        
+        for (int d = 0; d < dirCount; ++d) {
+            if (!canStep(x, y, d)) continue;
+            
+            int nx = x + dx8[d];
+            int ny = y + dy8[d];
+            int neighborIndex = ny * width + nx;
+            
+            // Cost of stepping from the neighbor into this tile, as A* would
+            float baseCost = d >= 4 ? 1.414f : 1.0f;
+            float newCost = cost + baseCost * traversal->GetTraversalCost(m_room, x, y);
+            
+            float& known = m_integration[neighborIndex];
+            if (known == unreached || newCost < known) {
+                known = newCost;
+                m_open.push_back({newCost, neighborIndex});
+                std::push_heap(m_open.begin(), m_open.end(), minHeap);
+            }
+        }
+    }
+    
+    // Direction field: each tile points at its cheapest neighbor
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int index = y * width + x;
+            if (m_integration[index] <= 0.0f) continue;  // Goal or unreachable
+            
+            float best = m_integration[index];
+            for (int d = 0; d < dirCount; ++d) {
+                if (!canStep(x, y, d)) continue;
+                int neighborIndex = (y + dy8[d]) * width + (x + dx8[d]);
+                float cost = m_integration[neighborIndex];
+                if (cost != unreached && cost < best) {
+                    best = cost;
+                    m_next[index] = neighborIndex;
+                }
+            }
+        }
+    }
+}
+
+bool FlowField::SampleDirection(Vector2 worldPos, Vector2& outDir) const {
+    if (!IsValid()) return false;
+    
+    int x, y;
+    if (!m_room->WorldToTile(worldPos, x, y)) return false;
+    
+    int index = y * Room::WIDTH + x;
+    Vector2 target;
+    if (x == m_goalX && y == m_goalY) {
+        target = m_goalWorld;
+    } else if (m_next[index] >= 0) {
+        target = m_room->TileToWorld(m_next[index] % Room::WIDTH, m_next[index] / Room::WIDTH);
+    } else {
+        return false;
+    }
+    
+    Vector2 toTarget = Vector2Subtract(target, worldPos);
+    if (Vector2LengthSqr(toTarget) < 0.01f) {
+        outDir = {0, 0};
+    } else {
+        outDir = Vector2Normalize(toTarget);
+    }
+    return true;
+}
+
+float FlowField::GetCost(int x, int y) const {
+    if (!IsValid() || x < 0 || x >= Room::WIDTH || y < 0 || y >= Room::HEIGHT) return -1.0f;
+    return m_integration[y * Room::WIDTH + x];
+}
+
+// ============================================================================
+// Path Request Queue Implementation
+// ============================================================================
+PathRequestQueue& PathRequestQueue::Instance() {
+    static PathRequestQueue instance;
+    return instance;
+}
+
+PathRequestQueue::~PathRequestQueue() {
+    Stop();
+}
+
+void PathRequestQueue::Start(int workerCount) {
+    Stop();
+    
+    m_stopping = false;
+    for (int i = 0; i < workerCount; ++i) {
+        m_contexts.push_back(std::make_unique<PathSearchContext>());
+    }
+    for (int i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&PathRequestQueue::WorkerLoop, this, i);
+    }
+}
+
+void PathRequestQueue::Stop() {
+    CancelAll();
+    
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+    
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+    m_contexts.clear();
+}
+
+uint32_t PathRequestQueue::Submit(Seeker* seeker, Room* room, Vector2 start, Vector2 end) {
+    uint32_t ticket;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ticket = m_nextTicket++;
+        if (m_nextTicket == 0) m_nextTicket = 1;  // 0 means "no request"
+        
+        Request request;
+        request.ticket = ticket;
+        request.seeker = seeker;
+        request.room = room;
+        request.start = start;
+        request.end = end;
+        m_pending.push_back(std::move(request));
+    }
+    m_workAvailable.notify_one();
+    return ticket;
+}
+
+void PathRequestQueue::Cancel(uint32_t ticket) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    auto matches = [ticket](const Request& request) { return request.ticket == ticket; };
+    m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(), matches), m_pending.end());
+    m_completed.erase(std::remove_if(m_completed.begin(), m_completed.end(), matches), m_completed.end());
+    
+    if (std::find(m_inFlight.begin(), m_inFlight.end(), ticket) != m_inFlight.end()) {
+        m_cancelledInFlight.push_back(ticket);
+    }
+    
+    // Already handed over for delivery (cancelled from a callback): the seeker
+    // may be gone before its turn, so forget it rather than erase mid-loop
+    for (Request& request : m_delivering) {
+        if (request.ticket == ticket) request.seeker = nullptr;
+    }
+}
+
+void PathRequestQueue::CancelAll() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_pending.clear();
+    
+    // In-flight searches still read their room; let them finish first
+    m_workFinished.wait(lock, [this] { return m_inFlight.empty(); });
+    m_completed.clear();
+    m_cancelledInFlight.clear();
+}
+
+int PathRequestQueue::GetPendingCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<int>(m_pending.size() + m_inFlight.size());
+}
+
+void PathRequestQueue::BeginFrame() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tokens = budget.maxRequestsPerFrame > 0 ? budget.maxRequestsPerFrame : INT_MAX;
+        m_syncMilliseconds = 0.0f;
+    }
+    m_workAvailable.notify_all();  // Fresh tokens
+}
+
+void PathRequestQueue::Update() {
+    PROFILE_SCOPE("PathRequestQueue::Update");
+    
+    Pathfinder& pathfinder = Pathfinder::Instance();
+    
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        
+        if (m_workers.empty()) {
+            // Synchronous mode: search here until the frame's budget runs out.
+            // Seekers can't be called back under the lock, so results still go
+            // through m_completed like worker results do.
+            auto start = std::chrono::steady_clock::now();
+            const float spentBefore = m_syncMilliseconds;
+            while (!m_pending.empty() && m_tokens > 0) {
+                if (budget.maxMilliseconds > 0.0f && m_syncMilliseconds >= budget.maxMilliseconds) break;
+                
+                Request request = std::move(m_pending.front());
+                m_pending.pop_front();
+                --m_tokens;
+                
+                pathfinder.Search(request.room, request.start, request.end, request.path, m_syncContext);
+                m_completed.push_back(std::move(request));
+                
+                m_syncMilliseconds = spentBefore + std::chrono::duration<float, std::milli>(
+                    std::chrono::steady_clock::now() - start).count();
+            }
+        }
+        
+        m_delivering.swap(m_completed);
+    }
+    
+    // Deliver on the game thread. A callback may submit requests (they go to
+    // m_pending) or cancel them, including ones further down this list.
+    m_deliveredLastFrame = 0;
+    for (Request& request : m_delivering) {
+        if (!request.seeker) continue;  // Cancelled since it completed
+        pathfinder.ApplyModifiers(request.path);
+        if (request.seeker->OnPathComplete(request.ticket, request.path)) {
+            ++m_deliveredLastFrame;
+        }
+    }
+    m_delivering.clear();
+}
+
+void PathRequestQueue::WorkerLoop(int index) {
+    Pathfinder& pathfinder = Pathfinder::Instance();
+    PathSearchContext& context = *m_contexts[index];
+    Profiler::Instance().SetThreadName("PathWorker");
+    
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_workAvailable.wait(lock, [this] {
+            return m_stopping || (!m_pending.empty() && m_tokens > 0);
+        });
+        if (m_stopping) return;
+        
+        Request request = std::move(m_pending.front());
+        m_pending.pop_front();
+        --m_tokens;
+        m_inFlight.push_back(request.ticket);
+        
+        lock.unlock();
+        {
+            PROFILE_SCOPE("PathWorker::Search");
+            pathfinder.Search(request.room, request.start, request.end, request.path, context);
+        }
+        lock.lock();
+        
+        m_inFlight.erase(std::find(m_inFlight.begin(), m_inFlight.end(), request.ticket));
+        auto cancelled = std::find(m_cancelledInFlight.begin(), m_cancelledInFlight.end(), request.ticket);
+        if (cancelled != m_cancelledInFlight.end()) {
+            m_cancelledInFlight.erase(cancelled);
+        } else {
+            m_completed.push_back(std::move(request));
+        }
+        m_workFinished.notify_all();
+    }
+}
+
 // ============================================================================
 // Seeker Implementation
 // ============================================================================
+Seeker::~Seeker() {
+    CancelPath();
+}
+
 void Seeker::StartPath(Vector2 start, Vector2 end, Room* room, OnPathCompleteCallback callback) {
+    // A newer request supersedes one that hasn't come back yet
+    CancelPath();
+    
+    m_start = start;
     m_destination = end;
     m_room = room;
     m_callback = callback;
     m_calculating = true;
     
-    // Calculate path immediately (could be made async in future)
-    m_currentPath = Pathfinder::Instance().FindPath(room, start, end);
+    if (deferSubmit) {
+        m_submitPending = true;
+        return;
+    }
+    m_requestTicket = PathRequestQueue::Instance().Submit(this, room, start, end);
+}
+
+void Seeker::SubmitDeferred() {
+    if (!m_submitPending) return;
+    
+    m_submitPending = false;
+    m_requestTicket = PathRequestQueue::Instance().Submit(this, m_room, m_start, m_destination);
+}
+
+void Seeker::CancelPath() {
+    if (!m_calculating) return;
+    
+    if (m_submitPending) {
+        m_submitPending = false;  // Never reached the queue
+    } else {
+        PathRequestQueue::Instance().Cancel(m_requestTicket);
+    }
+    m_requestTicket = 0;
+    m_calculating = false;
+}
+
+bool Seeker::OnPathComplete(uint32_t ticket, Path& path) {
+    // Superseded or cancelled (a deferred request may be waiting in its place)
+    if (ticket == 0 || ticket != m_requestTicket) return false;
+    
+    std::swap(m_currentPath, path);
     m_currentWaypoint = 0;
     m_calculating = false;
+    m_requestTicket = 0;
     
     if (m_callback) {
         m_callback(m_currentPath);
     }
+    return true;
 }
 
 Vector2 Seeker::GetNextWaypoint(Vector2 currentPos) const {
@@ -384,10 +830,20 @@ bool Seeker::ReachedEndOfPath(Vector2 currentPos, float threshold) const {
 void Seeker::ClearPath() {
     m_currentPath.vectorPath.clear();
     m_currentPath.error = false;
-    m_currentPath.errorMessage.clear();
+    m_currentPath.errorMessage = "";
     m_currentWaypoint = 0;
 }
 
+void Seeker::Reset() {
+    CancelPath();
+    ClearPath();
+    m_repathTimer = 0.0f;
+    m_start = {0, 0};
+    m_destination = {0, 0};
+    m_room = nullptr;
+    m_callback = nullptr;
+}
+
 void Seeker::Update(float dt) {
     m_repathTimer -= dt;
 }
@@ -400,8 +856,8 @@ Vector2 AIPathHelper::MoveToward(Seeker& seeker, Vector2 currentPos, Vector2 des
     // Update seeker timer
     seeker.Update(dt);
     
-    // Repath if needed
-    if (seeker.ShouldRepath() || !seeker.HasPath()) {
+    // Repath if needed (unless a request is already on its way)
+    if ((seeker.ShouldRepath() || !seeker.HasPath()) && seeker.IsDone()) {
         seeker.StartPath(currentPos, destination, room);
         seeker.ResetRepathTimer();
     }
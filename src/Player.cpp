@@ -5,7 +5,9 @@
 #include "Dungeon.hpp"
 #include "Utils.hpp"
 #include "SpriteManager.hpp"
+#include "RenderQueue.hpp"
 #include "AchievementManager.hpp"
+#include "Input.hpp"
 
 // Initialize static meta currency
 int Player::s_metaCurrency = 0;
@@ -90,6 +92,9 @@ void Player::Update(float dt) {
 }
 
 void Player::Render() {
+    float alpha = Game::Instance().GetInterpolationAlpha();
+    Vector2 pos = GetRenderPosition(alpha);
+    
     // Get sprite type based on character
     SpriteType spriteType = (m_characterType == CharacterType::TERRORIST) ? 
         SpriteType::PLAYER_TERRORIST : SpriteType::PLAYER_COUNTER_TERRORIST;
@@ -98,31 +103,34 @@ void Player::Render() {
     float rotation = atan2f(m_aimDirection.y, m_aimDirection.x) * RAD2DEG;
     
     // Draw player - use sprite if available, otherwise fallback to circle
+    RenderQueue& queue = RenderQueue::Instance();
     if (SpriteManager::Instance().HasSprite(spriteType)) {
-        SpriteManager::Instance().DrawFitRadius(spriteType, m_position, m_radius, rotation, WHITE);
+        SpriteManager::Instance().QueueFitRadius(RenderLayer::BODIES, spriteType, pos, m_radius, rotation, WHITE);
     } else {
         // Fallback to primitive rendering
-        DrawCircleV(m_position, m_radius, m_color);
+        queue.PushCircle(RenderLayer::BODIES, pos, m_radius, m_color);
         
         // Draw aim direction indicator
-        Vector2 aimEnd = Vector2Add(m_position, Vector2Scale(m_aimDirection, m_radius + 10));
-        DrawLineEx(m_position, aimEnd, 3.0f, WHITE);
+        Vector2 aimEnd = Vector2Add(pos, Vector2Scale(m_aimDirection, m_radius + 10));
+        queue.PushLine(RenderLayer::BODIES, pos, aimEnd, 3.0f, WHITE);
     }
     
     // Draw target indicator if we have a target
-    if (m_currentTarget && m_currentTarget->IsActive()) {
-        DrawCircleLinesV(m_currentTarget->GetPosition(), 
-                         m_currentTarget->GetRadius() + 5, RED);
+    EnemyManager* enemies = Game::Instance().GetEnemies();
+    int target = (m_targetId != 0 && enemies) ? enemies->FindById(m_targetId) : -1;
+    if (target >= 0) {
+        queue.PushCircleLines(RenderLayer::INDICATORS, enemies->GetRenderPosition(target, alpha), 
+                              enemies->GetRadius(target) + 5, RED);
     }
 }
 
 void Player::HandleMovement(float dt) {
     Vector2 moveDir = {0, 0};
     
-    if (IsKeyDown(KEY_W) || IsKeyDown(KEY_UP)) moveDir.y -= 1;
-    if (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN)) moveDir.y += 1;
-    if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT)) moveDir.x -= 1;
-    if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT)) moveDir.x += 1;
+    if (Input::IsKeyDown(KEY_W) || Input::IsKeyDown(KEY_UP)) moveDir.y -= 1;
+    if (Input::IsKeyDown(KEY_S) || Input::IsKeyDown(KEY_DOWN)) moveDir.y += 1;
+    if (Input::IsKeyDown(KEY_A) || Input::IsKeyDown(KEY_LEFT)) moveDir.x -= 1;
+    if (Input::IsKeyDown(KEY_D) || Input::IsKeyDown(KEY_RIGHT)) moveDir.x += 1;
     
     // Normalize diagonal movement
     if (Vector2Length(moveDir) > 0) {
@@ -156,11 +164,15 @@ void Player::UpdateAutoAim() {
     EnemyManager* enemies = Game::Instance().GetEnemies();
     if (!enemies) return;
     
-    Enemy* nearest = enemies->GetNearestEnemy(m_position, AIM_RANGE);
+    // Prefer a target we can actually hit, not one behind a pillar
+    int nearest = enemies->GetNearestEnemy(m_position, AIM_RANGE, true);
+    if (nearest < 0) {
+        nearest = enemies->GetNearestEnemy(m_position, AIM_RANGE);
+    }
     
-    if (nearest) {
-        m_currentTarget = nearest;
-        Vector2 toTarget = Vector2Subtract(nearest->GetPosition(), m_position);
+    if (nearest >= 0) {
+        m_targetId = enemies->GetId(nearest);
+        Vector2 toTarget = Vector2Subtract(enemies->GetPosition(nearest), m_position);
         Vector2 targetDir = Vector2Normalize(toTarget);
         
         // Smooth aim transition
@@ -169,7 +181,7 @@ void Player::UpdateAutoAim() {
         m_aimDirection.y = Utils::Lerp(m_aimDirection.y, targetDir.y, AIM_SMOOTHING * dt);
         m_aimDirection = Vector2Normalize(m_aimDirection);
     } else {
-        m_currentTarget = nullptr;
+        m_targetId = 0;
         
         // Default to movement direction or last aim direction
         if (Vector2Length(m_velocity) > 0.1f) {
@@ -308,7 +320,7 @@ void Player::Reset() {
     m_position = {0, 0};
     m_velocity = {0, 0};
     m_aimDirection = {1, 0};
-    m_currentTarget = nullptr;
+    m_targetId = 0;
     m_energyRegenDelay = 0.0f;
     m_energyRegenAccumulator = 0.0f;
     
@@ -0,0 +1,177 @@
+#include "Profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+    thread_local void* t_threadBuffer = nullptr;
+
+    constexpr float AVERAGE_WEIGHT = 0.1f;  // Exponential smoothing for the overlay
+}
+
+Profiler& Profiler::Instance() {
+    static Profiler instance;
+    return instance;
+}
+
+int64_t Profiler::NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Profiler::ThreadBuffer& Profiler::GetThreadBuffer() {
+    if (!t_threadBuffer) {
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->events.resize(RING_CAPACITY);
+
+        std::lock_guard<std::mutex> lock(m_registryMutex);
+        buffer->threadId = static_cast<int>(m_buffers.size());
+        t_threadBuffer = buffer.get();
+        m_buffers.push_back(std::move(buffer));
+    }
+    return *static_cast<ThreadBuffer*>(t_threadBuffer);
+}
+
+void Profiler::Record(ThreadBuffer& buffer, const char* name, int64_t startNs, int64_t endNs, int depth) {
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.events[buffer.head] = {name, startNs, endNs, depth};
+    buffer.head = (buffer.head + 1) % RING_CAPACITY;
+    buffer.count = std::min(buffer.count + 1, static_cast<size_t>(RING_CAPACITY));
+}
+
+void Profiler::SetThreadName(const char* name) {
+    if (!IsCompiledIn()) return;
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.name = name;
+}
+
+void Profiler::AddCount(const char* name, long long value) {
+    for (CounterStat& counter : m_counters) {
+        if (counter.name == name) {
+            counter.value += value;
+            return;
+        }
+    }
+    m_counters.push_back({name, value});
+}
+
+// ============================================================================
+// Zone
+// ============================================================================
+Profiler::Zone::Zone(const char* name) : m_name(name), m_startNs(NowNs()) {
+    ++Instance().GetThreadBuffer().depth;
+}
+
+Profiler::Zone::~Zone() {
+    int64_t endNs = NowNs();
+    Profiler& profiler = Instance();
+    ThreadBuffer& buffer = profiler.GetThreadBuffer();
+    int depth = --buffer.depth;
+    profiler.Record(buffer, m_name, m_startNs, endNs, depth);
+}
+
+// ============================================================================
+// Frame summary
+// ============================================================================
+void Profiler::NewFrame() {
+    if (!IsCompiledIn()) return;
+
+    int64_t now = NowNs();
+    if (!m_frameThread) {
+        m_frameThread = &GetThreadBuffer();
+    }
+
+    if (m_frameStartNs != 0) {
+        m_frameMs = static_cast<float>(now - m_frameStartNs) / 1.0e6f;
+
+        // Events are stored in the order zones closed, so walk back from the
+        // newest until one closed before this frame began
+        m_scratch.clear();
+        {
+            std::lock_guard<std::mutex> lock(m_frameThread->mutex);
+            size_t index = m_frameThread->head;
+            for (size_t n = 0; n < m_frameThread->count; ++n) {
+                index = (index + RING_CAPACITY - 1) % RING_CAPACITY;
+                const Event& event = m_frameThread->events[index];
+                if (event.endNs < m_frameStartNs) break;
+                m_scratch.push_back(event);
+            }
+        }
+
+        // Start order, parents before the children that started with them
+        std::sort(m_scratch.begin(), m_scratch.end(), [](const Event& a, const Event& b) {
+            return a.startNs != b.startNs ? a.startNs < b.startNs : a.depth < b.depth;
+        });
+
+        m_frameStats.clear();
+        for (const Event& event : m_scratch) {
+            float ms = static_cast<float>(event.endNs - event.startNs) / 1.0e6f;
+            auto it = std::find_if(m_frameStats.begin(), m_frameStats.end(), [&](const ZoneStat& stat) {
+                return stat.name == event.name && stat.depth == event.depth;
+            });
+            if (it != m_frameStats.end()) {
+                it->ms += ms;
+                ++it->calls;
+            } else {
+                m_frameStats.push_back({event.name, event.depth, 1, ms, ms});
+            }
+        }
+
+        for (ZoneStat& stat : m_frameStats) {
+            auto it = std::find_if(m_averages.begin(), m_averages.end(), [&](const ZoneStat& avg) {
+                return avg.name == stat.name && avg.depth == stat.depth;
+            });
+            if (it != m_averages.end()) {
+                it->avgMs += (stat.ms - it->avgMs) * AVERAGE_WEIGHT;
+                stat.avgMs = it->avgMs;
+            } else {
+                m_averages.push_back(stat);
+            }
+        }
+    }
+
+    // Counters that weren't touched this frame report zero rather than vanish
+    m_frameCounters = m_counters;
+    for (CounterStat& counter : m_counters) {
+        counter.value = 0;
+    }
+
+    m_frameStartNs = now;
+}
+
+// ============================================================================
+// Chrome trace export
+// ============================================================================
+bool Profiler::WriteChromeTrace(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+
+    std::lock_guard<std::mutex> registryLock(m_registryMutex);
+    for (const auto& buffer : m_buffers) {
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s %d\"}}",
+                first ? "" : ",\n", buffer->threadId, buffer->name, buffer->threadId);
+        first = false;
+
+        size_t index = (buffer->head + RING_CAPACITY - buffer->count) % RING_CAPACITY;
+        for (size_t n = 0; n < buffer->count; ++n) {
+            const Event& event = buffer->events[index];
+            index = (index + 1) % RING_CAPACITY;
+
+            double startUs = static_cast<double>(event.startNs - m_epochNs) / 1000.0;
+            double durationUs = static_cast<double>(event.endNs - event.startNs) / 1000.0;
+            fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    event.name, buffer->threadId, startUs, durationUs);
+        }
+    }
+
+    fprintf(file, "\n]}\n");
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    return ok;
+}
@@ -1,71 +1,207 @@
 #include "Projectile.hpp"
 #include "Utils.hpp"
-#include <algorithm>
+#include "Game.hpp"
+#include "Profiler.hpp"
+#include "RenderQueue.hpp"
 
-// Projectile implementation
-Projectile::Projectile(Vector2 pos, Vector2 dir, float speed, int damage,
-                       bool playerOwned, bool piercing, Color color, float size)
-    : Entity(pos, size)
-    , m_direction(Vector2Normalize(dir))
-    , m_speed(speed)
-    , m_damage(damage)
-    , m_playerOwned(playerOwned)
-    , m_piercing(piercing)
-    , m_color(color)
-{
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define EPITOME_PROJECTILE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define EPITOME_PROJECTILE_SSE2 1
+#endif
+
+const char* ProjectileManager::GetKernelName() {
+#if defined(EPITOME_PROJECTILE_AVX2)
+    return "avx2";
+#elif defined(EPITOME_PROJECTILE_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
 }
 
-void Projectile::Update(float dt) {
-    if (!m_active) return;
+void ProjectileManager::Update(float dt) {
+    PROFILE_SCOPE("ProjectileManager::Update");
     
-    // Move projectile
-    m_position = Vector2Add(m_position, Vector2Scale(m_direction, m_speed * dt));
+    Integrate(dt);
     
-    // Decrease lifetime
-    m_lifetime -= dt;
-    if (m_lifetime <= 0) {
-        m_active = false;
+    // Remove expired/destroyed projectiles. Swap-remove keeps this O(n) with
+    // no shifting; iterate backwards so each moved-in slot was already checked.
+    for (int i = GetCount() - 1; i >= 0; --i) {
+        if (m_lifetime[i] <= 0.0f || (m_flags[i] & FLAG_DESTROYED)) {
+            RemoveAt(i);
+        }
     }
 }
 
-void Projectile::Render() {
-    if (!m_active) return;
+void ProjectileManager::Integrate(float dt) {
+    const int count = GetCount();
+    float* posX = m_posX.data();
+    float* posY = m_posY.data();
+    float* prevX = m_prevX.data();
+    float* prevY = m_prevY.data();
+    const float* dirX = m_dirX.data();
+    const float* dirY = m_dirY.data();
+    const float* speed = m_speed.data();
+    float* lifetime = m_lifetime.data();
     
-    // Draw projectile as a small circle with a trail effect
-    DrawCircleV(m_position, m_radius, m_color);
+    int i = 0;
     
-    // Draw a simple trail
-    Vector2 trailEnd = Vector2Subtract(m_position, Vector2Scale(m_direction, m_radius * 2));
-    DrawLineEx(trailEnd, m_position, m_radius * 0.8f, 
-               ColorAlpha(m_color, 0.5f));
+#if defined(EPITOME_PROJECTILE_AVX2)
+    const __m256 vdt = _mm256_set1_ps(dt);
+    for (; i + 8 <= count; i += 8) {
+        __m256 step = _mm256_mul_ps(_mm256_loadu_ps(speed + i), vdt);
+        __m256 x = _mm256_loadu_ps(posX + i);
+        __m256 y = _mm256_loadu_ps(posY + i);
+        _mm256_storeu_ps(prevX + i, x);
+        _mm256_storeu_ps(prevY + i, y);
+        _mm256_storeu_ps(posX + i, _mm256_fmadd_ps(_mm256_loadu_ps(dirX + i), step, x));
+        _mm256_storeu_ps(posY + i, _mm256_fmadd_ps(_mm256_loadu_ps(dirY + i), step, y));
+        _mm256_storeu_ps(lifetime + i, _mm256_sub_ps(_mm256_loadu_ps(lifetime + i), vdt));
+    }
+#elif defined(EPITOME_PROJECTILE_SSE2)
+    const __m128 vdt = _mm_set1_ps(dt);
+    for (; i + 4 <= count; i += 4) {
+        __m128 step = _mm_mul_ps(_mm_loadu_ps(speed + i), vdt);
+        __m128 x = _mm_loadu_ps(posX + i);
+        __m128 y = _mm_loadu_ps(posY + i);
+        _mm_storeu_ps(prevX + i, x);
+        _mm_storeu_ps(prevY + i, y);
+        _mm_storeu_ps(posX + i, _mm_add_ps(x, _mm_mul_ps(_mm_loadu_ps(dirX + i), step)));
+        _mm_storeu_ps(posY + i, _mm_add_ps(y, _mm_mul_ps(_mm_loadu_ps(dirY + i), step)));
+        _mm_storeu_ps(lifetime + i, _mm_sub_ps(_mm_loadu_ps(lifetime + i), vdt));
+    }
+#endif
+    
+    // Scalar tail (or the whole range without SIMD)
+    for (; i < count; ++i) {
+        float step = speed[i] * dt;
+        prevX[i] = posX[i];
+        prevY[i] = posY[i];
+        posX[i] += dirX[i] * step;
+        posY[i] += dirY[i] * step;
+        lifetime[i] -= dt;
+    }
 }
 
-// ProjectileManager implementation
-void ProjectileManager::Update(float dt) {
-    for (auto& projectile : m_projectiles) {
-        projectile.Update(dt);
+void ProjectileManager::RemoveAt(int i) {
+    int last = GetCount() - 1;
+    if (i != last) {
+        m_posX[i] = m_posX[last];
+        m_posY[i] = m_posY[last];
+        m_prevX[i] = m_prevX[last];
+        m_prevY[i] = m_prevY[last];
+        m_dirX[i] = m_dirX[last];
+        m_dirY[i] = m_dirY[last];
+        m_speed[i] = m_speed[last];
+        m_lifetime[i] = m_lifetime[last];
+        m_radius[i] = m_radius[last];
+        m_damage[i] = m_damage[last];
+        m_flags[i] = m_flags[last];
+        m_color[i] = m_color[last];
     }
     
-    // Remove inactive projectiles
-    m_projectiles.erase(
-        std::remove_if(m_projectiles.begin(), m_projectiles.end(),
-            [](const Projectile& p) { return !p.IsActive(); }),
-        m_projectiles.end()
-    );
+    m_posX.pop_back();
+    m_posY.pop_back();
+    m_prevX.pop_back();
+    m_prevY.pop_back();
+    m_dirX.pop_back();
+    m_dirY.pop_back();
+    m_speed.pop_back();
+    m_lifetime.pop_back();
+    m_radius.pop_back();
+    m_damage.pop_back();
+    m_flags.pop_back();
+    m_color.pop_back();
 }
 
-void ProjectileManager::Render() {
-    for (auto& projectile : m_projectiles) {
-        projectile.Render();
+void ProjectileManager::Render(Rectangle view) {
+    PROFILE_SCOPE("ProjectileManager::Render");
+    
+    const int count = GetCount();
+    const float alpha = Game::Instance().GetInterpolationAlpha();
+    RenderQueue& queue = RenderQueue::Instance();
+    const bool instanced = m_instancingEnabled && m_instancedRenderer.Init();
+    m_instances.clear();
+    
+    // Projectiles sit in flat position arrays, so a bounds test per element
+    // is as cheap as any index would be; trails reach 2 radii behind
+    const float viewRight = view.x + view.width;
+    const float viewBottom = view.y + view.height;
+    int drawn = 0;
+    for (int i = 0; i < count; ++i) {
+        if (m_flags[i] & FLAG_DESTROYED) continue;
+        
+        Vector2 pos = {m_prevX[i] + (m_posX[i] - m_prevX[i]) * alpha,
+                       m_prevY[i] + (m_posY[i] - m_prevY[i]) * alpha};
+        float reach = m_radius[i] * 3.0f;
+        if (pos.x + reach < view.x || pos.x - reach > viewRight ||
+            pos.y + reach < view.y || pos.y - reach > viewBottom) {
+            continue;
+        }
+        ++drawn;
+        
+        if (instanced) {
+            m_instances.push_back({pos.x, pos.y, m_dirX[i], m_dirY[i], m_radius[i], m_color[i]});
+            continue;
+        }
+        Vector2 dir = {m_dirX[i], m_dirY[i]};
+        float radius = m_radius[i];
+        
+        // Draw projectile as a small circle with a trail effect
+        queue.PushCircle(RenderLayer::PROJECTILES, pos, radius, m_color[i]);
+        
+        // Draw a simple trail
+        Vector2 trailEnd = Vector2Subtract(pos, Vector2Scale(dir, radius * 2));
+        queue.PushLine(RenderLayer::PROJECTILES, trailEnd, pos, radius * 0.8f, ColorAlpha(m_color[i], 0.5f));
+    }
+    PROFILE_COUNT("Projectiles drawn", drawn);
+    
+    // One instanced draw, at the projectile layer's turn in the queue
+    if (!m_instances.empty()) {
+        queue.PushCallback(RenderLayer::PROJECTILES, [](void* user) {
+            ProjectileManager* self = static_cast<ProjectileManager*>(user);
+            self->m_instancedRenderer.Draw(self->m_instances);
+        }, this);
     }
 }
 
 void ProjectileManager::Clear() {
-    m_projectiles.clear();
+    m_posX.clear();
+    m_posY.clear();
+    m_prevX.clear();
+    m_prevY.clear();
+    m_dirX.clear();
+    m_dirY.clear();
+    m_speed.clear();
+    m_lifetime.clear();
+    m_radius.clear();
+    m_damage.clear();
+    m_flags.clear();
+    m_color.clear();
 }
 
 void ProjectileManager::SpawnProjectile(Vector2 pos, Vector2 dir, float speed, 
                                          int damage, bool playerOwned, 
                                          bool piercing, Color color, float size) {
-    m_projectiles.emplace_back(pos, dir, speed, damage, playerOwned, piercing, color, size);
+    Vector2 direction = Vector2Normalize(dir);
+    
+    uint8_t flags = 0;
+    if (playerOwned) flags |= FLAG_PLAYER_OWNED;
+    if (piercing) flags |= FLAG_PIERCING;
+    
+    m_posX.push_back(pos.x);
+    m_posY.push_back(pos.y);
+    m_prevX.push_back(pos.x);
+    m_prevY.push_back(pos.y);
+    m_dirX.push_back(direction.x);
+    m_dirY.push_back(direction.y);
+    m_speed.push_back(speed);
+    m_lifetime.push_back(LIFETIME);
+    m_radius.push_back(size);
+    m_damage.push_back(damage);
+    m_flags.push_back(flags);
+    m_color.push_back(color);
 }
@@ -0,0 +1,162 @@
+#include "ProjectileRenderer.hpp"
+#include "Profiler.hpp"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+namespace {
+    // Vertex attribute slots, fixed by layout qualifiers in the shader
+    constexpr unsigned int ATTRIB_CORNER = 0;
+    constexpr unsigned int ATTRIB_POS_DIR = 1;
+    constexpr unsigned int ATTRIB_RADIUS = 2;
+    constexpr unsigned int ATTRIB_COLOR = 3;
+
+    constexpr int MIN_CAPACITY = 1024;
+
+    // Quad in radii: x runs along the shot from 2 back (trail end) to 1 ahead,
+    // y across it. Matches the fallback: a circle plus a 0.8-radius-thick
+    // line reaching 2 radii behind the centre.
+    const char* VERTEX_BODY = R"(
+layout(location = 0) in vec2 corner;
+layout(location = 1) in vec4 instancePosDir;
+layout(location = 2) in float instanceRadius;
+layout(location = 3) in vec4 instanceColor;
+
+uniform mat4 mvp;
+
+out vec2 local;
+out vec4 tint;
+
+void main() {
+    local = vec2(mix(-2.0, 1.0, corner.x), mix(-1.0, 1.0, corner.y));
+    vec2 dir = instancePosDir.zw;
+    vec2 side = vec2(-dir.y, dir.x);
+    vec2 world = instancePosDir.xy + (dir * local.x + side * local.y) * instanceRadius;
+    tint = instanceColor;
+    gl_Position = mvp * vec4(world, 0.0, 1.0);
+}
+)";
+
+    const char* FRAGMENT_BODY = R"(
+in vec2 local;
+in vec4 tint;
+
+out vec4 finalColor;
+
+void main() {
+    if (dot(local, local) <= 1.0) {
+        finalColor = tint;
+    } else if (local.x <= 0.0 && abs(local.y) <= 0.4) {
+        finalColor = vec4(tint.rgb, tint.a * 0.5);
+    } else {
+        discard;
+    }
+}
+)";
+}
+
+ProjectileRenderer::~ProjectileRenderer() {
+    Unload();
+}
+
+bool ProjectileRenderer::Init() {
+    if (m_initTried) return IsReady();
+    m_initTried = true;
+
+    const char* header = nullptr;
+    switch (rlGetVersion()) {
+        case RL_OPENGL_33:
+        case RL_OPENGL_43:
+            header = "#version 330\n";
+            break;
+        case RL_OPENGL_ES_30:
+            header = "#version 300 es\nprecision mediump float;\n";
+            break;
+        default:
+            TraceLog(LOG_INFO, "ProjectileRenderer: No instancing on this GL version, using the primitive path");
+            return false;
+    }
+
+    std::string vertex = std::string(header) + VERTEX_BODY;
+    std::string fragment = std::string(header) + FRAGMENT_BODY;
+    m_shader = LoadShaderFromMemory(vertex.c_str(), fragment.c_str());
+    if (!IsShaderValid(m_shader)) {
+        TraceLog(LOG_WARNING, "ProjectileRenderer: Shader failed to build, using the primitive path");
+        m_shader = {0};
+        return false;
+    }
+    m_mvpLoc = GetShaderLocation(m_shader, "mvp");
+
+    // Two triangles covering the unit square
+    static const float QUAD[] = {0, 0,  1, 0,  1, 1,  0, 0,  1, 1,  0, 1};
+
+    m_vao = rlLoadVertexArray();
+    rlEnableVertexArray(m_vao);
+    m_quadVbo = rlLoadVertexBuffer(QUAD, sizeof(QUAD), false);
+    rlSetVertexAttribute(ATTRIB_CORNER, 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(ATTRIB_CORNER);
+    rlDisableVertexArray();
+
+    ReserveInstances(MIN_CAPACITY);
+    return true;
+}
+
+void ProjectileRenderer::Unload() {
+    if (m_instanceVbo) rlUnloadVertexBuffer(m_instanceVbo);
+    if (m_quadVbo) rlUnloadVertexBuffer(m_quadVbo);
+    if (m_vao) rlUnloadVertexArray(m_vao);
+    if (m_shader.id) UnloadShader(m_shader);
+    m_instanceVbo = 0;
+    m_quadVbo = 0;
+    m_vao = 0;
+    m_shader = {0};
+    m_capacity = 0;
+    m_initTried = false;
+}
+
+void ProjectileRenderer::ReserveInstances(int count) {
+    if (count <= m_capacity) return;
+
+    int capacity = std::max(m_capacity, MIN_CAPACITY);
+    while (capacity < count) capacity *= 2;
+
+    rlEnableVertexArray(m_vao);
+    if (m_instanceVbo) rlUnloadVertexBuffer(m_instanceVbo);
+    m_instanceVbo = rlLoadVertexBuffer(nullptr, capacity * static_cast<int>(sizeof(Instance)), true);
+
+    // One record per instance: vec4 position + direction, float radius, normalized RGBA8
+    const int stride = sizeof(Instance);
+    rlSetVertexAttribute(ATTRIB_POS_DIR, 4, RL_FLOAT, false, stride, offsetof(Instance, x));
+    rlSetVertexAttribute(ATTRIB_RADIUS, 1, RL_FLOAT, false, stride, offsetof(Instance, radius));
+    rlSetVertexAttribute(ATTRIB_COLOR, 4, RL_UNSIGNED_BYTE, true, stride, offsetof(Instance, color));
+    for (unsigned int attrib : {ATTRIB_POS_DIR, ATTRIB_RADIUS, ATTRIB_COLOR}) {
+        rlEnableVertexAttribute(attrib);
+        rlSetVertexAttributeDivisor(attrib, 1);
+    }
+    rlDisableVertexArray();
+
+    m_capacity = capacity;
+}
+
+void ProjectileRenderer::Draw(const std::vector<Instance>& instances) {
+    if (!IsReady() || instances.empty()) return;
+
+    const int count = static_cast<int>(instances.size());
+    ReserveInstances(count);
+
+    rlDrawRenderBatchActive();
+
+    rlUpdateVertexBuffer(m_instanceVbo, instances.data(), count * static_cast<int>(sizeof(Instance)), 0);
+
+    // Modelview carries the 2D camera
+    SetShaderValueMatrix(m_shader, m_mvpLoc, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    rlEnableShader(m_shader.id);
+    rlEnableVertexArray(m_vao);
+    rlDrawVertexArrayInstanced(0, 6, count);
+    rlDisableVertexArray();
+    rlDisableShader();
+
+    PROFILE_COUNT("Projectile draw calls", 1);
+}
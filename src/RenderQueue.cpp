@@ -0,0 +1,100 @@
+#include "RenderQueue.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+
+RenderQueue& RenderQueue::Instance() {
+    static RenderQueue instance;
+    return instance;
+}
+
+uint64_t RenderQueue::MakeKey(RenderLayer layer, unsigned int textureId, Kind kind, uint32_t sequence) {
+    return (static_cast<uint64_t>(layer) << 56) |
+           (static_cast<uint64_t>(textureId & 0xFFFFFFu) << 32) |
+           (static_cast<uint64_t>(kind) << 24) |
+           (sequence & 0xFFFFFFu);
+}
+
+void RenderQueue::Push(RenderLayer layer, unsigned int textureId, const Command& command) {
+    uint32_t index = static_cast<uint32_t>(m_commands.size());
+    m_commands.push_back(command);
+    m_keys.push_back({MakeKey(layer, textureId, command.kind, index), index});
+}
+
+void RenderQueue::PushSprite(RenderLayer layer, const Texture2D& texture, Rectangle source, Rectangle dest,
+                             Vector2 origin, float rotation, Color tint) {
+    Push(layer, texture.id, {Kind::SPRITE, tint, texture, source, dest, origin, rotation, 0});
+}
+
+void RenderQueue::PushCircle(RenderLayer layer, Vector2 center, float radius, Color color) {
+    Push(layer, 0, {Kind::CIRCLE, color, {}, {}, {center.x, center.y, radius, 0}, {}, 0.0f, 0});
+}
+
+void RenderQueue::PushCircleLines(RenderLayer layer, Vector2 center, float radius, Color color) {
+    Push(layer, 0, {Kind::CIRCLE_LINES, color, {}, {}, {center.x, center.y, radius, 0}, {}, 0.0f, 0});
+}
+
+void RenderQueue::PushRect(RenderLayer layer, Rectangle rect, Color color) {
+    Push(layer, 0, {Kind::RECT, color, {}, {}, rect, {}, 0.0f, 0});
+}
+
+void RenderQueue::PushLine(RenderLayer layer, Vector2 start, Vector2 end, float thickness, Color color) {
+    Push(layer, 0, {Kind::LINE, color, {}, {}, {start.x, start.y, end.x, end.y}, {}, thickness, 0});
+}
+
+void RenderQueue::PushCallback(RenderLayer layer, void (*callback)(void* user), void* user) {
+    uint32_t index = static_cast<uint32_t>(m_callbacks.size());
+    m_callbacks.push_back({callback, user});
+    Push(layer, 0, {Kind::CALLBACK, BLANK, {}, {}, {}, {}, 0.0f, index});
+}
+
+void RenderQueue::Flush() {
+    PROFILE_SCOPE("RenderQueue::Flush");
+
+    std::sort(m_keys.begin(), m_keys.end());
+
+    // A batch ends wherever the texture or primitive kind changes
+    constexpr uint64_t BATCH_MASK = 0x00FFFFFFFF000000ull;
+    uint64_t lastBatch = ~0ull;
+    int batches = 0;
+
+    for (const auto& [key, index] : m_keys) {
+        if ((key & BATCH_MASK) != lastBatch) {
+            lastBatch = key & BATCH_MASK;
+            ++batches;
+        }
+
+        const Command& command = m_commands[index];
+        const Rectangle& d = command.dest;
+        switch (command.kind) {
+            case Kind::SPRITE:
+                DrawTexturePro(command.texture, command.source, d, command.origin, command.param, command.color);
+                break;
+            case Kind::RECT:
+                DrawRectangleRec(d, command.color);
+                break;
+            case Kind::CIRCLE:
+                DrawCircleV({d.x, d.y}, d.width, command.color);
+                break;
+            case Kind::CIRCLE_LINES:
+                DrawCircleLinesV({d.x, d.y}, d.width, command.color);
+                break;
+            case Kind::LINE:
+                DrawLineEx({d.x, d.y}, {d.width, d.height}, command.param, command.color);
+                break;
+            case Kind::CALLBACK: {
+                const auto& [callback, user] = m_callbacks[command.callback];
+                callback(user);
+                break;
+            }
+        }
+    }
+
+    m_lastCommandCount = static_cast<int>(m_commands.size());
+    m_lastBatchCount = batches;
+    PROFILE_COUNT("Render queue commands", m_lastCommandCount);
+    PROFILE_COUNT("Render queue batches", m_lastBatchCount);
+
+    m_commands.clear();
+    m_keys.clear();
+    m_callbacks.clear();
+}
@@ -0,0 +1,78 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+
+SpatialGrid::SpatialGrid(float cellSize, int bucketCount)
+    : m_cellSize(cellSize)
+    , m_invCellSize(1.0f / cellSize)
+{
+    // Round bucket count up to a power of two so hashing is a mask
+    uint32_t buckets = 1;
+    while (buckets < static_cast<uint32_t>(std::max(bucketCount, 1))) {
+        buckets <<= 1;
+    }
+    m_bucketMask = buckets - 1;
+    m_bucketStart.assign(buckets + 1, 0);
+}
+
+void SpatialGrid::Clear() {
+    m_items.clear();
+    m_sortedIds.clear();
+    m_maxRadius = 0.0f;
+}
+
+void SpatialGrid::Insert(int id, Vector2 pos, float radius) {
+    m_items.push_back({id, Bucket(CellCoord(pos.x), CellCoord(pos.y))});
+    m_maxRadius = std::max(m_maxRadius, radius);
+}
+
+void SpatialGrid::Build() {
+    // Counting sort by bucket: count, prefix sum, scatter
+    std::fill(m_bucketStart.begin(), m_bucketStart.end(), 0u);
+    for (const Item& item : m_items) {
+        ++m_bucketStart[item.bucket + 1];
+    }
+    for (size_t i = 1; i < m_bucketStart.size(); ++i) {
+        m_bucketStart[i] += m_bucketStart[i - 1];
+    }
+
+    m_sortedIds.resize(m_items.size());
+
+    // Scatter in insertion order, using each bucket's start as its cursor
+    for (const Item& item : m_items) {
+        m_sortedIds[m_bucketStart[item.bucket]++] = item.id;
+    }
+
+    // Cursors now sit at each bucket's end (= next bucket's start); shift back
+    for (size_t i = m_bucketStart.size() - 1; i > 0; --i) {
+        m_bucketStart[i] = m_bucketStart[i - 1];
+    }
+    m_bucketStart[0] = 0;
+}
+
+void SpatialGrid::CollectInRect(Rectangle rect, std::vector<int>& out) const {
+    out.clear();
+    if (m_sortedIds.empty()) return;
+
+    int minX = CellCoord(rect.x - m_maxRadius);
+    int maxX = CellCoord(rect.x + rect.width + m_maxRadius);
+    int minY = CellCoord(rect.y - m_maxRadius);
+    int maxY = CellCoord(rect.y + rect.height + m_maxRadius);
+
+    // More cells than buckets: every bucket would be visited anyway
+    long long cells = static_cast<long long>(maxX - minX + 1) * (maxY - minY + 1);
+    if (cells > static_cast<long long>(m_bucketMask) + 1) {
+        out.assign(m_sortedIds.begin(), m_sortedIds.end());
+    } else {
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cx = minX; cx <= maxX; ++cx) {
+                uint32_t bucket = Bucket(cx, cy);
+                out.insert(out.end(), m_sortedIds.begin() + m_bucketStart[bucket],
+                           m_sortedIds.begin() + m_bucketStart[bucket + 1]);
+            }
+        }
+    }
+
+    // Cells sharing a bucket report it more than once
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
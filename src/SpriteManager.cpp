@@ -1,6 +1,13 @@
 #include "SpriteManager.hpp"
+#include "Profiler.hpp"
+#include "AssetPack.hpp"
 #include <filesystem>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <thread>
 #include <algorithm>
+#include <bit>
 #include <cmath>
 
 namespace fs = std::filesystem;
@@ -32,13 +39,13 @@ Rectangle SpriteData::GetCurrentFrame() const {
         return sourceRect;
     }
     
-    int framesPerRow = texture.width / frameWidth;
+    int framesPerRow = static_cast<int>(region.width) / frameWidth;
     int row = animation.currentFrame / framesPerRow;
     int col = animation.currentFrame % framesPerRow;
     
     return {
-        static_cast<float>(col * frameWidth),
-        static_cast<float>(row * frameHeight),
+        region.x + static_cast<float>(col * frameWidth),
+        region.y + static_cast<float>(row * frameHeight),
         static_cast<float>(frameWidth),
         static_cast<float>(frameHeight)
     };
@@ -47,6 +54,32 @@ Rectangle SpriteData::GetCurrentFrame() const {
 // ============================================================================
 // SpriteManager Implementation
 // ============================================================================
+// Streaming state. Everything but `decoded` is written by the loader thread
+// before it sets `decoded`, and only touched by the main thread after.
+struct SpriteManager::StreamJob {
+    std::string directory;
+    std::string packPath;
+    std::chrono::steady_clock::time_point start;
+    std::thread thread;
+    std::atomic<bool> decoded{false};
+    
+    AssetPackReader pack;                    // Open when loading from a pack
+    std::vector<SpriteType> types;
+    std::vector<Image> images;               // Only oversized (unpacked) images survive Compose
+    std::vector<TextureAtlas::Region> regions;
+    size_t nextOversized = 0;                // Main thread upload cursor
+    int loaded = 0;
+    
+    // Pack images are views into the mapping, only decoded ones are freed
+    void ReleaseImage(size_t index) {
+        if (!pack.IsOpen()) UnloadImage(images[index]);
+        images[index] = {0};
+    }
+};
+
+SpriteManager::SpriteManager() = default;
+SpriteManager::~SpriteManager() = default;
+
 SpriteManager& SpriteManager::Instance() {
     static SpriteManager instance;
     return instance;
@@ -55,28 +88,54 @@ SpriteManager& SpriteManager::Instance() {
 void SpriteManager::Init() {
     if (m_initialized) return;
     
-    m_sprites.clear();
+    m_sprites = {};
+    m_loadedMask = 0;
+    m_animatedMask = 0;
     m_initialized = true;
     
-    // Try to auto-load common sprites from asset path
-    LoadFromDirectory(m_assetPath);
+    // Try to auto-load common sprites from asset path (arrives over the
+    // first few frames, see UpdateStreaming)
+    BeginStreaming(m_assetPath, m_packPath);
 }
 
 void SpriteManager::Shutdown() {
-    for (auto& [type, sprite] : m_sprites) {
-        if (sprite.isLoaded) {
-            UnloadTexture(sprite.texture);
+    if (m_stream) {
+        // Nothing left to show it on; just let the loader finish and free its images
+        m_stream->thread.join();
+        for (size_t i = 0; i < m_stream->images.size(); ++i) {
+            m_stream->ReleaseImage(i);
         }
+        m_stream.reset();
+    }
+    
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        ReleaseSprite(static_cast<SpriteType>(i));
     }
-    m_sprites.clear();
+    m_atlas.Unload();
     m_initialized = false;
 }
 
+void SpriteManager::StoreSprite(SpriteType type, const SpriteData& sprite) {
+    ReleaseSprite(type);
+    m_sprites[static_cast<int>(type)] = sprite;
+    m_loadedMask |= Bit(type);
+    if (sprite.isAnimated) m_animatedMask |= Bit(type);
+}
+
+void SpriteManager::ReleaseSprite(SpriteType type) {
+    SpriteData& sprite = m_sprites[static_cast<int>(type)];
+    if (sprite.isLoaded && sprite.ownsTexture) {
+        UnloadTexture(sprite.texture);
+    }
+    sprite = SpriteData();
+    m_loadedMask &= ~Bit(type);
+    m_animatedMask &= ~Bit(type);
+}
+
 void SpriteManager::Update(float dt) {
-    for (auto& [type, sprite] : m_sprites) {
-        if (sprite.isAnimated && sprite.isLoaded) {
-            sprite.animation.Update(dt);
-        }
+    // Only animated sprites have anything to advance (usually none)
+    for (uint32_t mask = m_animatedMask; mask != 0; mask &= mask - 1) {
+        m_sprites[std::countr_zero(mask)].animation.Update(dt);
     }
 }
 
@@ -89,24 +148,21 @@ bool SpriteManager::LoadSprite(SpriteType type, const std::string& filename) {
         return false;
     }
     
-    // Unload existing sprite if present
-    if (m_sprites.count(type) && m_sprites[type].isLoaded) {
-        UnloadTexture(m_sprites[type].texture);
-    }
-    
     SpriteData sprite;
     sprite.texture = LoadTexture(fullPath.c_str());
     sprite.isLoaded = sprite.texture.id != 0;
+    sprite.ownsTexture = true;
     
     if (sprite.isLoaded) {
-        sprite.sourceRect = {0, 0, 
-                            static_cast<float>(sprite.texture.width),
-                            static_cast<float>(sprite.texture.height)};
+        sprite.region = {0, 0, 
+                         static_cast<float>(sprite.texture.width),
+                         static_cast<float>(sprite.texture.height)};
+        sprite.sourceRect = sprite.region;
         sprite.origin = {sprite.texture.width / 2.0f, sprite.texture.height / 2.0f};
         sprite.frameWidth = sprite.texture.width;
         sprite.frameHeight = sprite.texture.height;
         
-        m_sprites[type] = sprite;
+        StoreSprite(type, sprite);  // Replaces (and unloads) any existing sprite
         TraceLog(LOG_INFO, "SpriteManager: Loaded %s for %s", 
                  filename.c_str(), GetSpriteName(type));
         return true;
@@ -123,43 +179,29 @@ bool SpriteManager::LoadAnimatedSprite(SpriteType type, const std::string& filen
         return false;
     }
     
-    SpriteData& sprite = m_sprites[type];
+    SpriteData& sprite = m_sprites[static_cast<int>(type)];
     sprite.isAnimated = true;
+    m_animatedMask |= Bit(type);
     sprite.frameWidth = frameWidth;
     sprite.frameHeight = frameHeight;
     sprite.origin = {frameWidth / 2.0f, frameHeight / 2.0f};
-    sprite.sourceRect = {0, 0, static_cast<float>(frameWidth), static_cast<float>(frameHeight)};
+    sprite.sourceRect = {sprite.region.x, sprite.region.y,
+                         static_cast<float>(frameWidth), static_cast<float>(frameHeight)};
     
     sprite.animation.frameCount = frameCount;
     sprite.animation.frameTime = frameTime;
     sprite.animation.loop = loop;
-    sprite.animation.framesPerRow = sprite.texture.width / frameWidth;
+    sprite.animation.framesPerRow = static_cast<int>(sprite.region.width) / frameWidth;
     
     return true;
 }
 
 void SpriteManager::UnloadSprite(SpriteType type) {
-    if (m_sprites.count(type) && m_sprites[type].isLoaded) {
-        UnloadTexture(m_sprites[type].texture);
-        m_sprites.erase(type);
+    if (HasSprite(type)) {
+        ReleaseSprite(type);
     }
 }
 
-bool SpriteManager::HasSprite(SpriteType type) const {
-    auto it = m_sprites.find(type);
-    return it != m_sprites.end() && it->second.isLoaded;
-}
-
-SpriteData* SpriteManager::GetSprite(SpriteType type) {
-    auto it = m_sprites.find(type);
-    return it != m_sprites.end() ? &it->second : nullptr;
-}
-
-const SpriteData* SpriteManager::GetSprite(SpriteType type) const {
-    auto it = m_sprites.find(type);
-    return it != m_sprites.end() ? &it->second : nullptr;
-}
-
 // ============================================================================
 // Drawing Functions
 // ============================================================================
@@ -178,7 +220,7 @@ void SpriteManager::Draw(SpriteType type, Vector2 position, float rotation, floa
 void SpriteManager::Draw(SpriteType type, Vector2 position, float rotation, float scale, Color tint) {
     if (!HasSprite(type)) return;
     
-    const SpriteData& sprite = m_sprites[type];
+    const SpriteData& sprite = m_sprites[static_cast<int>(type)];
     DrawInternal(sprite, position, rotation, scale, tint);
 }
 
@@ -190,14 +232,23 @@ void SpriteManager::DrawFitRadius(SpriteType type, Vector2 position, float radiu
                                    float rotation, Color tint) {
     if (!HasSprite(type)) return;
     
-    const SpriteData& sprite = m_sprites[type];
+    const SpriteData& sprite = m_sprites[static_cast<int>(type)];
+    DrawInternal(sprite, position, rotation, FitRadiusScale(sprite, radius), tint);
+}
+
+void SpriteManager::QueueFitRadius(RenderLayer layer, SpriteType type, Vector2 position, float radius,
+                                    float rotation, Color tint) {
+    if (!HasSprite(type)) return;
     
+    const SpriteData& sprite = m_sprites[static_cast<int>(type)];
+    DrawInternal(sprite, position, rotation, FitRadiusScale(sprite, radius), tint, layer);
+}
+
+float SpriteManager::FitRadiusScale(const SpriteData& sprite, float radius) {
     // Calculate scale to fit the sprite within the radius
     Rectangle srcRect = sprite.GetCurrentFrame();
     float maxDim = fmaxf(srcRect.width, srcRect.height);
-    float scale = (radius * 2.0f) / maxDim;
-    
-    DrawInternal(sprite, position, rotation, scale, tint);
+    return (radius * 2.0f) / maxDim;
 }
 
 void SpriteManager::DrawRect(SpriteType type, Rectangle destRect) {
@@ -207,15 +258,32 @@ void SpriteManager::DrawRect(SpriteType type, Rectangle destRect) {
 void SpriteManager::DrawRect(SpriteType type, Rectangle destRect, Color tint) {
     if (!HasSprite(type)) return;
     
-    const SpriteData& sprite = m_sprites[type];
+    const SpriteData& sprite = m_sprites[static_cast<int>(type)];
     Rectangle srcRect = sprite.GetCurrentFrame();
     
     Vector2 origin = {0, 0};
-    DrawTexturePro(sprite.texture, srcRect, destRect, origin, 0.0f, tint);
+    SubmitDraw(sprite, srcRect, destRect, origin, 0.0f, tint, std::nullopt);
+}
+
+void SpriteManager::SubmitDraw(const SpriteData& sprite, Rectangle srcRect, Rectangle destRect,
+                               Vector2 origin, float rotation, Color tint, std::optional<RenderLayer> layer) {
+    if (layer) {
+        RenderQueue::Instance().PushSprite(*layer, sprite.texture, srcRect, destRect, origin, rotation, tint);
+        return;
+    }
+    
+    // Consecutive sprites on the same page batch into one draw call
+    if (sprite.texture.id != m_lastTextureId) {
+        m_lastTextureId = sprite.texture.id;
+        PROFILE_COUNT("Sprite texture switches", 1);
+    }
+    
+    DrawTexturePro(sprite.texture, srcRect, destRect, origin, rotation, tint);
 }
 
 void SpriteManager::DrawInternal(const SpriteData& sprite, Vector2 position,
-                                  float rotation, float scale, Color tint) {
+                                  float rotation, float scale, Color tint,
+                                  std::optional<RenderLayer> layer) {
     Rectangle srcRect = sprite.GetCurrentFrame();
     
     Rectangle destRect = {
@@ -238,52 +306,210 @@ void SpriteManager::DrawInternal(const SpriteData& sprite, Vector2 position,
         static_cast<unsigned char>((tint.a * sprite.tint.a) / 255)
     };
     
-    DrawTexturePro(sprite.texture, srcRect, destRect, origin, 
-                   rotation + sprite.rotation, finalTint);
+    SubmitDraw(sprite, srcRect, destRect, origin, rotation + sprite.rotation, finalTint, layer);
 }
 
 // ============================================================================
 // Configuration Functions
 // ============================================================================
 void SpriteManager::SetSpriteScale(SpriteType type, float scale) {
-    if (m_sprites.count(type)) {
-        m_sprites[type].scale = scale;
+    if (HasSprite(type)) {
+        m_sprites[static_cast<int>(type)].scale = scale;
     }
 }
 
 void SpriteManager::SetSpriteOrigin(SpriteType type, Vector2 origin) {
-    if (m_sprites.count(type)) {
-        m_sprites[type].origin = origin;
+    if (HasSprite(type)) {
+        m_sprites[static_cast<int>(type)].origin = origin;
     }
 }
 
 void SpriteManager::SetSpriteTint(SpriteType type, Color tint) {
-    if (m_sprites.count(type)) {
-        m_sprites[type].tint = tint;
+    if (HasSprite(type)) {
+        m_sprites[static_cast<int>(type)].tint = tint;
     }
 }
 
 int SpriteManager::LoadFromDirectory(const std::string& directory) {
-    int loaded = 0;
+    BeginStreaming(directory);
+    return FinishStreaming();
+}
+
+// ============================================================================
+// Streaming
+// ============================================================================
+void SpriteManager::BeginStreaming(const std::string& directory, const std::string& packPath) {
+    if (m_stream) {
+        FinishStreaming();
+    }
     
+    // Sprites already on the old pages would be left pointing at freed textures
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        SpriteType type = static_cast<SpriteType>(i);
+        if (HasSprite(type) && !m_sprites[i].ownsTexture) {
+            ReleaseSprite(type);
+        }
+    }
+    m_atlas.Unload();
+    
+    m_stream = std::make_unique<StreamJob>();
+    m_stream->directory = directory;
+    m_stream->packPath = packPath;
+    m_stream->start = std::chrono::steady_clock::now();
+    m_stream->thread = std::thread(&SpriteManager::RunStreamJob, std::ref(*m_stream), std::ref(m_atlas));
+}
+
+void SpriteManager::RunStreamJob(StreamJob& job, TextureAtlas& atlas) {
+    // A baked pack stands in for the whole directory: no probing, no decode
+    if (!job.packPath.empty() && job.pack.Open(job.packPath)) {
+        for (int i = 0; i < SPRITE_COUNT; ++i) {
+            SpriteType type = static_cast<SpriteType>(i);
+            if (const AssetPack::Entry* entry = job.pack.Find(GetSpriteName(type))) {
+                job.types.push_back(type);
+                job.images.push_back(job.pack.GetImage(*entry));
+            }
+        }
+    } else {
+        DecodeDirectory(job);
+    }
+    
+    // Packing and page composition are CPU work too; only the upload is left
+    job.regions = atlas.Compose(job.images);
+    for (size_t i = 0; i < job.images.size(); ++i) {
+        if (job.regions[i].page >= 0) {
+            job.ReleaseImage(i);
+        }
+    }
+    
+    job.decoded.store(true, std::memory_order_release);
+}
+
+void SpriteManager::DecodeDirectory(StreamJob& job) {
     // Try to load default sprites based on naming convention
-    for (int i = 0; i < static_cast<int>(SpriteType::COUNT); ++i) {
+    std::vector<std::string> paths;
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
         SpriteType type = static_cast<SpriteType>(i);
-        std::string filename = GetDefaultFilename(type);
-        std::string fullPath = directory + filename;
-        
+        std::string fullPath = job.directory + GetDefaultFilename(type);
         if (FileExists(fullPath.c_str())) {
-            if (LoadSprite(type, filename)) {
-                loaded++;
-            }
+            job.types.push_back(type);
+            paths.push_back(fullPath);
         }
     }
     
-    TraceLog(LOG_INFO, "SpriteManager: Auto-loaded %d sprites from %s", 
-             loaded, directory.c_str());
+    // Decode in parallel; this thread takes a share too
+    const int count = static_cast<int>(paths.size());
+    job.images.assign(count, Image{0});
+    std::atomic<int> next{0};
+    auto decode = [&]() {
+        for (int i = next++; i < count; i = next++) {
+            job.images[i] = LoadImage(paths[i].c_str());
+        }
+    };
+    
+    int helpers = std::min(std::clamp(static_cast<int>(std::thread::hardware_concurrency()) - 1, 0, 3),
+                           count - 1);
+    std::vector<std::thread> pool;
+    for (int i = 0; i < helpers; ++i) {
+        pool.emplace_back(decode);
+    }
+    decode();
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+    
+    for (int i = count - 1; i >= 0; --i) {
+        if (!job.images[i].data) {
+            TraceLog(LOG_WARNING, "SpriteManager: Failed to load image: %s", paths[i].c_str());
+            job.images.erase(job.images.begin() + i);
+            job.types.erase(job.types.begin() + i);
+        }
+    }
+}
+
+void SpriteManager::UpdateStreaming(int maxUploads) {
+    if (!m_stream || !m_stream->decoded.load(std::memory_order_acquire)) return;
+    
+    if (DrainUploads(maxUploads)) {
+        CompleteStreaming();
+    }
+}
+
+int SpriteManager::FinishStreaming() {
+    if (!m_stream) return 0;
+    
+    m_stream->thread.join();  // decoded is set before the loader returns
+    while (!DrainUploads(INT_MAX)) {}
+    int loaded = m_stream->loaded;
+    CompleteStreaming();
     return loaded;
 }
 
+void SpriteManager::CompleteStreaming() {
+    if (m_stream->thread.joinable()) {
+        m_stream->thread.join();
+    }
+    float ms = std::chrono::duration<float, std::milli>(
+        std::chrono::steady_clock::now() - m_stream->start).count();
+    const std::string& source = m_stream->pack.IsOpen() ? m_stream->packPath : m_stream->directory;
+    TraceLog(LOG_INFO, "SpriteManager: Streamed %d sprites from %s in %.1f ms (%d atlas pages)", 
+             m_stream->loaded, source.c_str(), ms, m_atlas.GetPageCount());
+    m_stream.reset();
+}
+
+bool SpriteManager::DrainUploads(int maxUploads) {
+    StreamJob& job = *m_stream;
+    
+    for (int uploads = 0; uploads < maxUploads; ++uploads) {
+        // Atlas pages first: one upload brings in every sprite on the page
+        int page = m_atlas.UploadNextPage();
+        if (page >= 0) {
+            for (size_t i = 0; i < job.types.size(); ++i) {
+                const TextureAtlas::Region& region = job.regions[i];
+                if (region.page != page) continue;
+                
+                SpriteData sprite;
+                sprite.texture = m_atlas.GetPage(page);
+                sprite.isLoaded = sprite.texture.id != 0;
+                sprite.region = region.rect;
+                sprite.sourceRect = region.rect;
+                sprite.origin = {region.rect.width / 2.0f, region.rect.height / 2.0f};
+                sprite.frameWidth = static_cast<int>(region.rect.width);
+                sprite.frameHeight = static_cast<int>(region.rect.height);
+                
+                if (sprite.isLoaded) {
+                    StoreSprite(job.types[i], sprite);
+                    job.loaded++;
+                }
+            }
+            continue;
+        }
+        
+        // Then anything too big for a page, as its own texture
+        while (job.nextOversized < job.types.size() && job.regions[job.nextOversized].page >= 0) {
+            job.nextOversized++;
+        }
+        if (job.nextOversized == job.types.size()) return true;
+        
+        size_t i = job.nextOversized++;
+        SpriteData sprite;
+        sprite.texture = LoadTextureFromImage(job.images[i]);
+        sprite.isLoaded = sprite.texture.id != 0;
+        sprite.ownsTexture = true;
+        sprite.region = {0, 0, static_cast<float>(sprite.texture.width), static_cast<float>(sprite.texture.height)};
+        sprite.sourceRect = sprite.region;
+        sprite.origin = {sprite.texture.width / 2.0f, sprite.texture.height / 2.0f};
+        sprite.frameWidth = sprite.texture.width;
+        sprite.frameHeight = sprite.texture.height;
+        job.ReleaseImage(i);
+        
+        if (sprite.isLoaded) {
+            StoreSprite(job.types[i], sprite);
+            job.loaded++;
+        }
+    }
+    return false;
+}
+
 // ============================================================================
 // Utility Functions
 // ============================================================================
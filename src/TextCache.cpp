@@ -0,0 +1,129 @@
+#include "TextCache.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+
+namespace {
+    // raylib's DrawText rules: sizes below the font's 10px are bumped up,
+    // spacing is size / 10, lines advance by size + 2
+    constexpr int DEFAULT_FONT_SIZE = 10;
+    constexpr int LINE_SPACING = 2;
+}
+
+TextCache& TextCache::Instance() {
+    static TextCache instance;
+    return instance;
+}
+
+int TextCache::Measure(const char* text, int fontSize) {
+    const Entry* entry = m_enabled ? Get(text, fontSize) : nullptr;
+    return entry ? entry->width : MeasureText(text, fontSize);
+}
+
+void TextCache::Draw(const char* text, int x, int y, int fontSize, Color color) {
+    const Entry* entry = m_enabled ? Get(text, fontSize) : nullptr;
+    if (!entry) {
+        DrawText(text, x, y, fontSize, color);
+        return;
+    }
+
+    const float fx = static_cast<float>(x);
+    const float fy = static_cast<float>(y);
+    for (const Glyph& glyph : entry->glyphs) {
+        Rectangle dest = {fx + glyph.dest.x, fy + glyph.dest.y, glyph.dest.width, glyph.dest.height};
+        DrawTexturePro(m_fontTexture, glyph.source, dest, {0, 0}, 0.0f, color);
+    }
+}
+
+const TextCache::Entry* TextCache::Get(const char* text, int fontSize) {
+    Font font = GetFontDefault();
+    if (font.texture.id == 0) return nullptr;
+
+    // Window recreated: every cached quad points into the old texture
+    if (font.texture.id != m_fontTexture.id) {
+        Clear();
+        m_fontTexture = font.texture;
+    }
+
+    auto sizeIt = std::find_if(m_sizes.begin(), m_sizes.end(),
+                               [fontSize](const auto& size) { return size.first == fontSize; });
+    if (sizeIt == m_sizes.end()) {
+        m_sizes.emplace_back(fontSize, SizeMap{});
+        sizeIt = m_sizes.end() - 1;
+    }
+
+    SizeMap& entries = sizeIt->second;
+    auto it = entries.find(std::string_view(text));
+    if (it == entries.end()) {
+        PROFILE_COUNT("Text cache misses", 1);
+        it = entries.emplace(text, Layout(font, text, fontSize)).first;
+    }
+    it->second.lastUsed = m_frame;
+    return &it->second;
+}
+
+TextCache::Entry TextCache::Layout(const Font& font, const char* text, int fontSize) {
+    Entry entry;
+    entry.width = MeasureText(text, fontSize);
+
+    // Same walk as DrawTextEx/DrawTextCodepoint, recording quads instead of drawing
+    const int size = std::max(fontSize, DEFAULT_FONT_SIZE);
+    const float spacing = static_cast<float>(size / DEFAULT_FONT_SIZE);
+    const float scale = static_cast<float>(size) / font.baseSize;
+    const float padding = static_cast<float>(font.glyphPadding);
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+
+    for (int i = 0; text[i] != '\0';) {
+        int bytes = 0;
+        int codepoint = GetCodepointNext(&text[i], &bytes);
+        int index = GetGlyphIndex(font, codepoint);
+        i += std::max(bytes, 1);
+
+        if (codepoint == '\n') {
+            offsetY += static_cast<float>(size + LINE_SPACING);
+            offsetX = 0.0f;
+            continue;
+        }
+
+        const Rectangle& rec = font.recs[index];
+        const GlyphInfo& info = font.glyphs[index];
+        if (codepoint != ' ' && codepoint != '\t') {
+            entry.glyphs.push_back({
+                {rec.x - padding, rec.y - padding, rec.width + 2.0f * padding, rec.height + 2.0f * padding},
+                {offsetX + (info.offsetX - padding) * scale, offsetY + (info.offsetY - padding) * scale,
+                 (rec.width + 2.0f * padding) * scale, (rec.height + 2.0f * padding) * scale}
+            });
+        }
+
+        float advance = info.advanceX != 0 ? static_cast<float>(info.advanceX) : rec.width;
+        offsetX += advance * scale + spacing;
+    }
+    return entry;
+}
+
+void TextCache::NewFrame() {
+    ++m_frame;
+    PROFILE_COUNT("Text cache entries", GetEntryCount());
+    if (m_frame % SWEEP_INTERVAL != 0) return;
+
+    for (auto& [size, entries] : m_sizes) {
+        std::erase_if(entries, [this](const auto& item) { return m_frame - item.second.lastUsed > EVICT_AFTER_FRAMES; });
+    }
+}
+
+void TextCache::Clear() {
+    m_sizes.clear();
+}
+
+void TextCache::SetEnabled(bool enabled) {
+    m_enabled = enabled;
+    if (!enabled) Clear();
+}
+
+int TextCache::GetEntryCount() const {
+    size_t count = 0;
+    for (const auto& [size, entries] : m_sizes) {
+        count += entries.size();
+    }
+    return static_cast<int>(count);
+}
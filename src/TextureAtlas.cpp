@@ -0,0 +1,218 @@
+#include "TextureAtlas.hpp"
+#include <algorithm>
+
+// ============================================================================
+// Skyline Packer Implementation
+// ============================================================================
+SkylinePacker::SkylinePacker(int width, int height)
+    : m_width(width)
+    , m_height(height)
+{
+    m_skyline.push_back({0, 0, width});
+}
+
+int SkylinePacker::FitAt(int index, int w, int h) const {
+    int x = m_skyline[index].x;
+    if (x + w > m_width) return -1;
+
+    // Resting height is the highest segment under the rectangle's span
+    int y = 0;
+    int widthLeft = w;
+    for (size_t i = index; widthLeft > 0; ++i) {
+        y = std::max(y, m_skyline[i].y);
+        if (y + h > m_height) return -1;
+        widthLeft -= m_skyline[i].width;
+    }
+    return y;
+}
+
+bool SkylinePacker::Insert(int w, int h, int& outX, int& outY) {
+    int bestIndex = -1;
+    int bestBottom = m_height + 1;
+    int bestWidth = m_width + 1;
+
+    for (int i = 0; i < static_cast<int>(m_skyline.size()); ++i) {
+        int y = FitAt(i, w, h);
+        if (y < 0) continue;
+
+        int bottom = y + h;
+        if (bottom < bestBottom || (bottom == bestBottom && m_skyline[i].width < bestWidth)) {
+            bestIndex = i;
+            bestBottom = bottom;
+            bestWidth = m_skyline[i].width;
+        }
+    }
+    if (bestIndex < 0) return false;
+
+    outX = m_skyline[bestIndex].x;
+    outY = bestBottom - h;
+
+    // Raise the skyline over the new rectangle, then trim what it covers
+    m_skyline.insert(m_skyline.begin() + bestIndex, {outX, bestBottom, w});
+    for (size_t i = bestIndex + 1; i < m_skyline.size();) {
+        const Segment& prev = m_skyline[i - 1];
+        Segment& segment = m_skyline[i];
+        int overlap = prev.x + prev.width - segment.x;
+        if (overlap <= 0) break;
+
+        segment.x += overlap;
+        segment.width -= overlap;
+        if (segment.width > 0) break;
+        m_skyline.erase(m_skyline.begin() + i);
+    }
+
+    // Merge neighbours at the same height
+    for (size_t i = 1; i < m_skyline.size();) {
+        if (m_skyline[i - 1].y == m_skyline[i].y) {
+            m_skyline[i - 1].width += m_skyline[i].width;
+            m_skyline.erase(m_skyline.begin() + i);
+        } else {
+            ++i;
+        }
+    }
+    return true;
+}
+
+int SkylinePacker::GetUsedHeight() const {
+    int used = 0;
+    for (const Segment& segment : m_skyline) {
+        used = std::max(used, segment.y);
+    }
+    return used;
+}
+
+// ============================================================================
+// Texture Atlas Implementation
+// ============================================================================
+namespace {
+    struct Placement {
+        int page = -1;
+        int x = 0;
+        int y = 0;
+    };
+
+    int NextPowerOfTwo(int value) {
+        int result = 1;
+        while (result < value) result <<= 1;
+        return result;
+    }
+}
+
+TextureAtlas::~TextureAtlas() {
+    Unload();
+}
+
+void TextureAtlas::Unload() {
+    for (Texture2D& page : m_pages) {
+        UnloadTexture(page);
+    }
+    for (size_t i = m_pages.size(); i < m_pageImages.size(); ++i) {
+        UnloadImage(m_pageImages[i]);
+    }
+    m_pages.clear();
+    m_pageImages.clear();
+}
+
+int TextureAtlas::UploadNextPage() {
+    int page = static_cast<int>(m_pages.size());
+    if (page >= static_cast<int>(m_pageImages.size())) return -1;
+
+    m_pages.push_back(LoadTextureFromImage(m_pageImages[page]));
+    UnloadImage(m_pageImages[page]);
+    m_pageImages[page] = {0};
+    return page;
+}
+
+std::vector<TextureAtlas::Region> TextureAtlas::Build(const std::vector<Image>& images) {
+    Unload();
+    std::vector<Region> regions = Compose(images);
+    while (UploadNextPage() >= 0) {}
+    return regions;
+}
+
+std::vector<TextureAtlas::Region> TextureAtlas::Compose(const std::vector<Image>& images) {
+
+    const int count = static_cast<int>(images.size());
+    std::vector<Region> regions(count);
+    std::vector<Placement> placements(count);
+
+    // Tallest first packs noticeably tighter on a skyline
+    std::vector<int> order;
+    for (int i = 0; i < count; ++i) {
+        int w = images[i].width + 2 * PADDING;
+        int h = images[i].height + 2 * PADDING;
+        if (images[i].data && w <= MAX_PAGE_SIZE && h <= MAX_PAGE_SIZE) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&images](int a, int b) {
+        if (images[a].height != images[b].height) return images[a].height > images[b].height;
+        return images[a].width > images[b].width;
+    });
+    if (order.empty()) return regions;
+
+    // Smallest square page that takes everything; otherwise fill full-size
+    // pages one after another
+    std::vector<SkylinePacker> packers;
+    for (int size = 256; size <= MAX_PAGE_SIZE && packers.empty(); size *= 2) {
+        SkylinePacker packer(size, size);
+        bool fits = true;
+        for (int index : order) {
+            Placement& placement = placements[index];
+            if (!packer.Insert(images[index].width + 2 * PADDING, images[index].height + 2 * PADDING,
+                               placement.x, placement.y)) {
+                fits = false;
+                break;
+            }
+            placement.page = 0;
+        }
+        if (fits) packers.push_back(packer);
+    }
+
+    if (packers.empty()) {
+        for (int index : order) {
+            Placement& placement = placements[index];
+            placement.page = -1;
+            int w = images[index].width + 2 * PADDING;
+            int h = images[index].height + 2 * PADDING;
+            for (int page = 0; page < static_cast<int>(packers.size()) && placement.page < 0; ++page) {
+                if (packers[page].Insert(w, h, placement.x, placement.y)) placement.page = page;
+            }
+            if (placement.page < 0) {
+                packers.emplace_back(MAX_PAGE_SIZE, MAX_PAGE_SIZE);
+                packers.back().Insert(w, h, placement.x, placement.y);
+                placement.page = static_cast<int>(packers.size()) - 1;
+            }
+        }
+    }
+
+    // Compose each page on the CPU; UploadNextPage() sends them to the GPU
+    for (int page = 0; page < static_cast<int>(packers.size()); ++page) {
+        int width = packers[page].GetWidth();
+        int height = std::min(NextPowerOfTwo(packers[page].GetUsedHeight()), packers[page].GetHeight());
+        Image canvas = GenImageColor(width, height, BLANK);
+
+        for (int index : order) {
+            if (placements[index].page != page) continue;
+
+            Image source = ImageCopy(images[index]);
+            ImageFormat(&source, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+            Rectangle rect = {
+                static_cast<float>(placements[index].x + PADDING),
+                static_cast<float>(placements[index].y + PADDING),
+                static_cast<float>(source.width),
+                static_cast<float>(source.height)
+            };
+            ImageDraw(&canvas, source, {0, 0, rect.width, rect.height}, rect, WHITE);
+            UnloadImage(source);
+
+            regions[index].page = page;
+            regions[index].rect = rect;
+        }
+
+        m_pageImages.push_back(canvas);
+    }
+
+    return regions;
+}
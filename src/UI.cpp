@@ -3,6 +3,9 @@
 #include "Weapon.hpp"
 #include "Game.hpp"
 #include "Dungeon.hpp"
+#include "Input.hpp"
+#include "Profiler.hpp"
+#include "TextCache.hpp"
 
 UIManager::UIManager() {
 }
@@ -16,6 +19,8 @@ void UIManager::Render() {
 }
 
 void UIManager::RenderHUD(Player* player) {
+    PROFILE_SCOPE("UIManager::RenderHUD");
+    
     if (!player) return;
     
     const int padding = 20;
@@ -29,7 +34,7 @@ void UIManager::RenderHUD(Player* player) {
         player->GetHealth(), player->GetMaxHealth(),
         RED
     );
-    DrawText("HP", padding, padding + barHeight + 2, 14, WHITE);
+    Text::Draw("HP", padding, padding + barHeight + 2, 14, WHITE);
     
     // Energy bar (below health)
     DrawHealthBar(
@@ -38,14 +43,14 @@ void UIManager::RenderHUD(Player* player) {
         player->GetEnergy(), player->GetMaxEnergy(),
         BLUE
     );
-    DrawText("ENERGY", padding, padding + barHeight * 2 + 22, 14, WHITE);
+    Text::Draw("ENERGY", padding, padding + barHeight * 2 + 22, 14, WHITE);
     
     // Weapon info (top-right)
     Weapon* weapon = player->GetWeapon();
     if (weapon) {
         const char* weaponName = weapon->GetName().c_str();
-        int textWidth = MeasureText(weaponName, 20);
-        DrawText(weaponName, Game::SCREEN_WIDTH - textWidth - padding, padding, 20, WHITE);
+        int textWidth = Text::Measure(weaponName, 20);
+        Text::Draw(weaponName, Game::SCREEN_WIDTH - textWidth - padding, padding, 20, WHITE);
         
         // Weapon cooldown indicator
         if (!weapon->CanFire()) {
@@ -68,29 +73,29 @@ void UIManager::RenderHUD(Player* player) {
     };
     
     DrawCooldownIndicator(abilityCenter, 35, abilityCooldown, PURPLE);
-    DrawText("SKILL", static_cast<int>(abilityCenter.x - 20), 
-             static_cast<int>(abilityCenter.y + 40), 14, WHITE);
+    Text::Draw("SKILL", static_cast<int>(abilityCenter.x - 20), 
+               static_cast<int>(abilityCenter.y + 40), 14, WHITE);
     
     // Currency (bottom-right)
     char currencyText[32];
     snprintf(currencyText, sizeof(currencyText), "$ %d", player->GetRunCurrency());
-    int currencyWidth = MeasureText(currencyText, 24);
-    DrawText(currencyText, Game::SCREEN_WIDTH - currencyWidth - padding,
-             Game::SCREEN_HEIGHT - padding - 24, 24, GOLD);
+    int currencyWidth = Text::Measure(currencyText, 24);
+    Text::Draw(currencyText, Game::SCREEN_WIDTH - currencyWidth - padding,
+               Game::SCREEN_HEIGHT - padding - 24, 24, GOLD);
     
     // Level display (top-center)
     DungeonManager* dungeon = Game::Instance().GetDungeon();
     if (dungeon) {
         char levelText[32];
         snprintf(levelText, sizeof(levelText), "LEVEL %d-%d", dungeon->GetStage(), dungeon->GetSubLevel());
-        int levelWidth = MeasureText(levelText, 28);
-        DrawText(levelText, (Game::SCREEN_WIDTH - levelWidth) / 2, padding, 28, WHITE);
+        int levelWidth = Text::Measure(levelText, 28);
+        Text::Draw(levelText, (Game::SCREEN_WIDTH - levelWidth) / 2, padding, 28, WHITE);
         
         // Boss indicator
         if (dungeon->IsBossLevel()) {
             const char* bossText = "BOSS";
-            int bossWidth = MeasureText(bossText, 20);
-            DrawText(bossText, (Game::SCREEN_WIDTH - bossWidth) / 2, padding + 32, 20, RED);
+            int bossWidth = Text::Measure(bossText, 20);
+            Text::Draw(bossText, (Game::SCREEN_WIDTH - bossWidth) / 2, padding + 32, 20, RED);
         }
     }
     
@@ -102,22 +107,22 @@ void UIManager::RenderHUD(Player* player) {
 
 void UIManager::RenderMainMenu() {
     const char* title = "Codename: Epitome";
-    int titleWidth = MeasureText(title, 60);
-    DrawText(title, (Game::SCREEN_WIDTH - titleWidth) / 2, 150, 60, WHITE);
+    int titleWidth = Text::Measure(title, 60);
+    Text::Draw(title, (Game::SCREEN_WIDTH - titleWidth) / 2, 150, 60, WHITE);
     
     // Pulsing start text
     float alpha = (sinf(m_animTimer * 3.0f) + 1.0f) / 2.0f;
     Color startColor = ColorAlpha(WHITE, 0.5f + alpha * 0.5f);
     
     const char* startText = "Press ENTER or SPACE to start";
-    int startWidth = MeasureText(startText, 24);
-    DrawText(startText, (Game::SCREEN_WIDTH - startWidth) / 2, 400, 24, startColor);
+    int startWidth = Text::Measure(startText, 24);
+    Text::Draw(startText, (Game::SCREEN_WIDTH - startWidth) / 2, 400, 24, startColor);
     
     // Controls hint
     const char* controls = "WASD - Move | LMB - Shoot | RMB/SPACE - Ability";
-    int controlsWidth = MeasureText(controls, 16);
-    DrawText(controls, (Game::SCREEN_WIDTH - controlsWidth) / 2, 
-             Game::SCREEN_HEIGHT - 50, 16, GRAY);
+    int controlsWidth = Text::Measure(controls, 16);
+    Text::Draw(controls, (Game::SCREEN_WIDTH - controlsWidth) / 2, 
+               Game::SCREEN_HEIGHT - 50, 16, GRAY);
 }
 
 void UIManager::RenderPauseMenu() {
@@ -126,14 +131,14 @@ void UIManager::RenderPauseMenu() {
                   ColorAlpha(BLACK, 0.7f));
     
     const char* pauseText = "PAUSED";
-    int pauseWidth = MeasureText(pauseText, 48);
-    DrawText(pauseText, (Game::SCREEN_WIDTH - pauseWidth) / 2, 
-             Game::SCREEN_HEIGHT / 2 - 50, 48, WHITE);
+    int pauseWidth = Text::Measure(pauseText, 48);
+    Text::Draw(pauseText, (Game::SCREEN_WIDTH - pauseWidth) / 2, 
+               Game::SCREEN_HEIGHT / 2 - 50, 48, WHITE);
     
     const char* resumeText = "Press ESC to resume";
-    int resumeWidth = MeasureText(resumeText, 20);
-    DrawText(resumeText, (Game::SCREEN_WIDTH - resumeWidth) / 2,
-             Game::SCREEN_HEIGHT / 2 + 20, 20, GRAY);
+    int resumeWidth = Text::Measure(resumeText, 20);
+    Text::Draw(resumeText, (Game::SCREEN_WIDTH - resumeWidth) / 2,
+               Game::SCREEN_HEIGHT / 2 + 20, 20, GRAY);
 }
 
 void UIManager::RenderGameOver(int score) {
@@ -141,23 +146,23 @@ void UIManager::RenderGameOver(int score) {
                   ColorAlpha(BLACK, 0.85f));
     
     const char* gameOverText = "GAME OVER";
-    int gameOverWidth = MeasureText(gameOverText, 60);
-    DrawText(gameOverText, (Game::SCREEN_WIDTH - gameOverWidth) / 2,
-             Game::SCREEN_HEIGHT / 2 - 80, 60, RED);
+    int gameOverWidth = Text::Measure(gameOverText, 60);
+    Text::Draw(gameOverText, (Game::SCREEN_WIDTH - gameOverWidth) / 2,
+               Game::SCREEN_HEIGHT / 2 - 80, 60, RED);
     
     char scoreText[64];
     snprintf(scoreText, sizeof(scoreText), "Score: %d", score);
-    int scoreWidth = MeasureText(scoreText, 32);
-    DrawText(scoreText, (Game::SCREEN_WIDTH - scoreWidth) / 2,
-             Game::SCREEN_HEIGHT / 2, 32, WHITE);
+    int scoreWidth = Text::Measure(scoreText, 32);
+    Text::Draw(scoreText, (Game::SCREEN_WIDTH - scoreWidth) / 2,
+               Game::SCREEN_HEIGHT / 2, 32, WHITE);
     
     float alpha = (sinf(m_animTimer * 3.0f) + 1.0f) / 2.0f;
     Color retryColor = ColorAlpha(WHITE, 0.5f + alpha * 0.5f);
     
     const char* retryText = "Press ENTER to return to menu";
-    int retryWidth = MeasureText(retryText, 20);
-    DrawText(retryText, (Game::SCREEN_WIDTH - retryWidth) / 2,
-             Game::SCREEN_HEIGHT / 2 + 60, 20, retryColor);
+    int retryWidth = Text::Measure(retryText, 20);
+    Text::Draw(retryText, (Game::SCREEN_WIDTH - retryWidth) / 2,
+               Game::SCREEN_HEIGHT / 2 + 60, 20, retryColor);
 }
 
 void UIManager::RenderFloorClear(
@@ -167,12 +172,12 @@ void UIManager::RenderFloorClear(
                   ColorAlpha(BLACK, 0.75f));
     
     const char* clearText = "FLOOR CLEARED!";
-    int clearWidth = MeasureText(clearText, 48);
-    DrawText(clearText, (Game::SCREEN_WIDTH - clearWidth) / 2, 100, 48, GREEN);
+    int clearWidth = Text::Measure(clearText, 48);
+    Text::Draw(clearText, (Game::SCREEN_WIDTH - clearWidth) / 2, 100, 48, GREEN);
     
     const char* selectText = "Select a buff:";
-    int selectWidth = MeasureText(selectText, 24);
-    DrawText(selectText, (Game::SCREEN_WIDTH - selectWidth) / 2, 180, 24, WHITE);
+    int selectWidth = Text::Measure(selectText, 24);
+    Text::Draw(selectText, (Game::SCREEN_WIDTH - selectWidth) / 2, 180, 24, WHITE);
     
     // Draw buff options
     int buffWidth = 250;
@@ -191,21 +196,21 @@ void UIManager::RenderFloorClear(
             static_cast<float>(buffHeight)
         };
         
-        bool hovered = CheckCollisionPointRec(GetMousePosition(), buffRect);
+        bool hovered = CheckCollisionPointRec(Input::GetMousePosition(), buffRect);
         Color bgColor = hovered ? Color{80, 80, 100, 255} : Color{50, 50, 70, 255};
         
         DrawRectangleRec(buffRect, bgColor);
         DrawRectangleLinesEx(buffRect, 2, hovered ? WHITE : GRAY);
         
         // Draw buff name centered
-        int textWidth = MeasureText(buffs[i].first.c_str(), 18);
-        DrawText(buffs[i].first.c_str(),
-                 static_cast<int>(buffRect.x + (buffWidth - textWidth) / 2),
-                 static_cast<int>(buffRect.y + buffHeight / 2 - 9),
-                 18, WHITE);
+        int textWidth = Text::Measure(buffs[i].first.c_str(), 18);
+        Text::Draw(buffs[i].first.c_str(),
+                   static_cast<int>(buffRect.x + (buffWidth - textWidth) / 2),
+                   static_cast<int>(buffRect.y + buffHeight / 2 - 9),
+                   18, WHITE);
         
         // Handle click
-        if (hovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        if (hovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
             if (buffs[i].second) {
                 buffs[i].second();
             }
@@ -215,20 +220,22 @@ void UIManager::RenderFloorClear(
 
 void UIManager::RenderShop() {
     // Shop UI would go here
-    DrawText("SHOP (Coming Soon)", 100, 100, 30, WHITE);
+    Text::Draw("SHOP (Coming Soon)", 100, 100, 30, WHITE);
 }
 
 void UIManager::RenderBuffSelection(const std::vector<BuffData>& buffs) {
+    PROFILE_SCOPE("UIManager::RenderBuffSelection");
+    
     DrawRectangle(0, 0, Game::SCREEN_WIDTH, Game::SCREEN_HEIGHT,
                   ColorAlpha(Color{20, 20, 30, 255}, 1.0f));
     
     const char* titleText = "CHOOSE YOUR STARTING BUFF";
-    int titleWidth = MeasureText(titleText, 40);
-    DrawText(titleText, (Game::SCREEN_WIDTH - titleWidth) / 2, 80, 40, GOLD);
+    int titleWidth = Text::Measure(titleText, 40);
+    Text::Draw(titleText, (Game::SCREEN_WIDTH - titleWidth) / 2, 80, 40, GOLD);
     
     const char* subtitleText = "Select one buff to begin your run";
-    int subtitleWidth = MeasureText(subtitleText, 20);
-    DrawText(subtitleText, (Game::SCREEN_WIDTH - subtitleWidth) / 2, 140, 20, LIGHTGRAY);
+    int subtitleWidth = Text::Measure(subtitleText, 20);
+    Text::Draw(subtitleText, (Game::SCREEN_WIDTH - subtitleWidth) / 2, 140, 20, LIGHTGRAY);
     
     // Draw buff options
     int buffWidth = 280;
@@ -247,7 +254,7 @@ void UIManager::RenderBuffSelection(const std::vector<BuffData>& buffs) {
             static_cast<float>(buffHeight)
         };
         
-        bool hovered = CheckCollisionPointRec(GetMousePosition(), buffRect);
+        bool hovered = CheckCollisionPointRec(Input::GetMousePosition(), buffRect);
         Color bgColor = hovered ? Color{60, 80, 120, 255} : Color{40, 50, 80, 255};
         Color borderColor = hovered ? GOLD : Color{100, 100, 140, 255};
         
@@ -255,45 +262,47 @@ void UIManager::RenderBuffSelection(const std::vector<BuffData>& buffs) {
         DrawRectangleLinesEx(buffRect, hovered ? 3.0f : 2.0f, borderColor);
         
         // Draw buff name centered
-        int nameWidth = MeasureText(buffs[i].name.c_str(), 22);
-        DrawText(buffs[i].name.c_str(),
-                 static_cast<int>(buffRect.x + (buffWidth - nameWidth) / 2),
-                 static_cast<int>(buffRect.y + 25),
-                 22, WHITE);
+        int nameWidth = Text::Measure(buffs[i].name.c_str(), 22);
+        Text::Draw(buffs[i].name.c_str(),
+                   static_cast<int>(buffRect.x + (buffWidth - nameWidth) / 2),
+                   static_cast<int>(buffRect.y + 25),
+                   22, WHITE);
         
         // Draw buff description
-        int descWidth = MeasureText(buffs[i].description.c_str(), 16);
-        DrawText(buffs[i].description.c_str(),
-                 static_cast<int>(buffRect.x + (buffWidth - descWidth) / 2),
-                 static_cast<int>(buffRect.y + 65),
-                 16, LIGHTGRAY);
+        int descWidth = Text::Measure(buffs[i].description.c_str(), 16);
+        Text::Draw(buffs[i].description.c_str(),
+                   static_cast<int>(buffRect.x + (buffWidth - descWidth) / 2),
+                   static_cast<int>(buffRect.y + 65),
+                   16, LIGHTGRAY);
         
         // Handle click
-        if (hovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        if (hovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
             Game::Instance().StartGameWithBuff(static_cast<int>(i));
         }
     }
     
     // Instructions at bottom
     const char* instructText = "Click a buff to start the game";
-    int instructWidth = MeasureText(instructText, 18);
+    int instructWidth = Text::Measure(instructText, 18);
     float alpha = (sinf(m_animTimer * 2.0f) + 1.0f) / 2.0f;
-    DrawText(instructText, (Game::SCREEN_WIDTH - instructWidth) / 2, 
-             Game::SCREEN_HEIGHT - 80, 18, ColorAlpha(WHITE, 0.5f + alpha * 0.5f));
+    Text::Draw(instructText, (Game::SCREEN_WIDTH - instructWidth) / 2, 
+               Game::SCREEN_HEIGHT - 80, 18, ColorAlpha(WHITE, 0.5f + alpha * 0.5f));
 }
 
 void UIManager::RenderFloorBuffSelection(const std::vector<BuffData>& buffs) {
+    PROFILE_SCOPE("UIManager::RenderFloorBuffSelection");
+    
     // Semi-transparent overlay over the game world
     DrawRectangle(0, 0, Game::SCREEN_WIDTH, Game::SCREEN_HEIGHT,
                   ColorAlpha(BLACK, 0.85f));
     
     const char* titleText = "FLOOR CLEARED!";
-    int titleWidth = MeasureText(titleText, 50);
-    DrawText(titleText, (Game::SCREEN_WIDTH - titleWidth) / 2, 60, 50, GREEN);
+    int titleWidth = Text::Measure(titleText, 50);
+    Text::Draw(titleText, (Game::SCREEN_WIDTH - titleWidth) / 2, 60, 50, GREEN);
     
     const char* subtitleText = "Choose a buff to continue";
-    int subtitleWidth = MeasureText(subtitleText, 22);
-    DrawText(subtitleText, (Game::SCREEN_WIDTH - subtitleWidth) / 2, 130, 22, LIGHTGRAY);
+    int subtitleWidth = Text::Measure(subtitleText, 22);
+    Text::Draw(subtitleText, (Game::SCREEN_WIDTH - subtitleWidth) / 2, 130, 22, LIGHTGRAY);
     
     // Draw buff options
     int buffWidth = 280;
@@ -312,7 +321,7 @@ void UIManager::RenderFloorBuffSelection(const std::vector<BuffData>& buffs) {
             static_cast<float>(buffHeight)
         };
         
-        bool hovered = CheckCollisionPointRec(GetMousePosition(), buffRect);
+        bool hovered = CheckCollisionPointRec(Input::GetMousePosition(), buffRect);
         Color bgColor = hovered ? Color{50, 100, 70, 255} : Color{30, 60, 45, 255};
         Color borderColor = hovered ? GREEN : Color{80, 140, 100, 255};
         
@@ -320,31 +329,31 @@ void UIManager::RenderFloorBuffSelection(const std::vector<BuffData>& buffs) {
         DrawRectangleLinesEx(buffRect, hovered ? 3.0f : 2.0f, borderColor);
         
         // Draw buff name centered
-        int nameWidth = MeasureText(buffs[i].name.c_str(), 24);
-        DrawText(buffs[i].name.c_str(),
-                 static_cast<int>(buffRect.x + (buffWidth - nameWidth) / 2),
-                 static_cast<int>(buffRect.y + 30),
-                 24, WHITE);
+        int nameWidth = Text::Measure(buffs[i].name.c_str(), 24);
+        Text::Draw(buffs[i].name.c_str(),
+                   static_cast<int>(buffRect.x + (buffWidth - nameWidth) / 2),
+                   static_cast<int>(buffRect.y + 30),
+                   24, WHITE);
         
         // Draw buff description
-        int descWidth = MeasureText(buffs[i].description.c_str(), 16);
-        DrawText(buffs[i].description.c_str(),
-                 static_cast<int>(buffRect.x + (buffWidth - descWidth) / 2),
-                 static_cast<int>(buffRect.y + 75),
-                 16, LIGHTGRAY);
+        int descWidth = Text::Measure(buffs[i].description.c_str(), 16);
+        Text::Draw(buffs[i].description.c_str(),
+                   static_cast<int>(buffRect.x + (buffWidth - descWidth) / 2),
+                   static_cast<int>(buffRect.y + 75),
+                   16, LIGHTGRAY);
         
         // Handle click
-        if (hovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        if (hovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
             Game::Instance().ApplyFloorBuff(static_cast<int>(i));
         }
     }
     
     // Instructions at bottom
     const char* instructText = "Click a buff to continue to the next floor";
-    int instructWidth = MeasureText(instructText, 18);
+    int instructWidth = Text::Measure(instructText, 18);
     float alpha = (sinf(m_animTimer * 2.0f) + 1.0f) / 2.0f;
-    DrawText(instructText, (Game::SCREEN_WIDTH - instructWidth) / 2, 
-             Game::SCREEN_HEIGHT - 80, 18, ColorAlpha(WHITE, 0.5f + alpha * 0.5f));
+    Text::Draw(instructText, (Game::SCREEN_WIDTH - instructWidth) / 2, 
+               Game::SCREEN_HEIGHT - 80, 18, ColorAlpha(WHITE, 0.5f + alpha * 0.5f));
 }
 
 void UIManager::DrawHealthBar(Vector2 pos, float width, float height,
@@ -365,9 +374,9 @@ void UIManager::DrawHealthBar(Vector2 pos, float width, float height,
     // Text
     char text[32];
     snprintf(text, sizeof(text), "%d/%d", current, max);
-    int textWidth = MeasureText(text, 14);
-    DrawText(text, static_cast<int>(pos.x + (width - textWidth) / 2),
-             static_cast<int>(pos.y + (height - 14) / 2), 14, WHITE);
+    int textWidth = Text::Measure(text, 14);
+    Text::Draw(text, static_cast<int>(pos.x + (width - textWidth) / 2),
+               static_cast<int>(pos.y + (height - 14) / 2), 14, WHITE);
 }
 
 void UIManager::DrawCooldownIndicator(Vector2 center, float radius,
@@ -378,8 +387,8 @@ void UIManager::DrawCooldownIndicator(Vector2 center, float radius,
     if (percent <= 0) {
         // Ready - full color
         DrawCircleV(center, radius - 3, color);
-        DrawText("READY", static_cast<int>(center.x - 20),
-                 static_cast<int>(center.y - 7), 14, WHITE);
+        Text::Draw("READY", static_cast<int>(center.x - 20),
+                   static_cast<int>(center.y - 7), 14, WHITE);
     } else {
         // On cooldown - draw partial circle
         DrawCircleV(center, radius - 3, ColorAlpha(color, 0.3f));
@@ -396,30 +405,32 @@ void UIManager::DrawCooldownIndicator(Vector2 center, float radius,
 }
 
 bool UIManager::Button(Rectangle bounds, const std::string& text, int fontSize) {
-    bool hovered = CheckCollisionPointRec(GetMousePosition(), bounds);
+    bool hovered = CheckCollisionPointRec(Input::GetMousePosition(), bounds);
     Color bgColor = hovered ? Color{80, 80, 100, 255} : Color{50, 50, 70, 255};
     
     DrawRectangleRec(bounds, bgColor);
     DrawRectangleLinesEx(bounds, 2, hovered ? WHITE : GRAY);
     
-    int textWidth = MeasureText(text.c_str(), fontSize);
-    DrawText(text.c_str(),
-             static_cast<int>(bounds.x + (bounds.width - textWidth) / 2),
-             static_cast<int>(bounds.y + (bounds.height - fontSize) / 2),
-             fontSize, WHITE);
+    int textWidth = Text::Measure(text.c_str(), fontSize);
+    Text::Draw(text.c_str(),
+               static_cast<int>(bounds.x + (bounds.width - textWidth) / 2),
+               static_cast<int>(bounds.y + (bounds.height - fontSize) / 2),
+               fontSize, WHITE);
     
-    return hovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+    return hovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
 }
 
 void UIManager::RenderHub(CharacterType selectedCharacter) {
+    PROFILE_SCOPE("UIManager::RenderHub");
+    
     // Title
     const char* title = "THE HUB";
-    int titleWidth = MeasureText(title, 50);
-    DrawText(title, (Game::SCREEN_WIDTH - titleWidth) / 2, 20, 50, WHITE);
+    int titleWidth = Text::Measure(title, 50);
+    Text::Draw(title, (Game::SCREEN_WIDTH - titleWidth) / 2, 20, 50, WHITE);
     
     const char* subtitle = "Select your character, then enter the portal";
-    int subtitleWidth = MeasureText(subtitle, 18);
-    DrawText(subtitle, (Game::SCREEN_WIDTH - subtitleWidth) / 2, 75, 18, LIGHTGRAY);
+    int subtitleWidth = Text::Measure(subtitle, 18);
+    Text::Draw(subtitle, (Game::SCREEN_WIDTH - subtitleWidth) / 2, 75, 18, LIGHTGRAY);
     
     // Character selection boxes - larger to fit passive info
     float boxWidth = 280;
@@ -431,7 +442,7 @@ void UIManager::RenderHub(CharacterType selectedCharacter) {
     // Character 1: Terrorist
     CharacterData terroristData = Player::GetCharacterData(CharacterType::TERRORIST);
     Rectangle terroristBox = {startX, y, boxWidth, boxHeight};
-    bool terroristHovered = CheckCollisionPointRec(GetMousePosition(), terroristBox);
+    bool terroristHovered = CheckCollisionPointRec(Input::GetMousePosition(), terroristBox);
     bool terroristSelected = (selectedCharacter == CharacterType::TERRORIST);
     
     Color terroristBg = terroristSelected ? Color{80, 50, 50, 255} : 
@@ -445,53 +456,53 @@ void UIManager::RenderHub(CharacterType selectedCharacter) {
                static_cast<int>(terroristBox.y + 50), 35, terroristData.color);
     
     // Name
-    int nameWidth = MeasureText(terroristData.name.c_str(), 24);
-    DrawText(terroristData.name.c_str(), 
-             static_cast<int>(terroristBox.x + (boxWidth - nameWidth) / 2),
-             static_cast<int>(terroristBox.y + 95), 24, WHITE);
+    int nameWidth = Text::Measure(terroristData.name.c_str(), 24);
+    Text::Draw(terroristData.name.c_str(), 
+               static_cast<int>(terroristBox.x + (boxWidth - nameWidth) / 2),
+               static_cast<int>(terroristBox.y + 95), 24, WHITE);
     
     // Stats
     char statsText[64];
     snprintf(statsText, sizeof(statsText), "HP: %d  Energy: %d", 
              terroristData.stats.maxHealth, terroristData.stats.maxEnergy);
-    DrawText(statsText, static_cast<int>(terroristBox.x + 15),
-             static_cast<int>(terroristBox.y + 130), 14, LIGHTGRAY);
-    DrawText("Weapon: Pistol", static_cast<int>(terroristBox.x + 15),
-             static_cast<int>(terroristBox.y + 148), 14, LIGHTGRAY);
-    DrawText("Skill: Explosion", static_cast<int>(terroristBox.x + 15),
-             static_cast<int>(terroristBox.y + 166), 14, ORANGE);
+    Text::Draw(statsText, static_cast<int>(terroristBox.x + 15),
+               static_cast<int>(terroristBox.y + 130), 14, LIGHTGRAY);
+    Text::Draw("Weapon: Pistol", static_cast<int>(terroristBox.x + 15),
+               static_cast<int>(terroristBox.y + 148), 14, LIGHTGRAY);
+    Text::Draw("Skill: Explosion", static_cast<int>(terroristBox.x + 15),
+               static_cast<int>(terroristBox.y + 166), 14, ORANGE);
     
     // Passive ability
     DrawLine(static_cast<int>(terroristBox.x + 15), static_cast<int>(terroristBox.y + 190),
              static_cast<int>(terroristBox.x + boxWidth - 15), static_cast<int>(terroristBox.y + 190), GRAY);
-    DrawText("PASSIVE:", static_cast<int>(terroristBox.x + 15),
-             static_cast<int>(terroristBox.y + 200), 12, GOLD);
-    DrawText(terroristData.passiveName.c_str(), static_cast<int>(terroristBox.x + 15),
-             static_cast<int>(terroristBox.y + 215), 14, YELLOW);
-    DrawText(terroristData.passiveDescription.c_str(), static_cast<int>(terroristBox.x + 15),
-             static_cast<int>(terroristBox.y + 235), 11, LIGHTGRAY);
+    Text::Draw("PASSIVE:", static_cast<int>(terroristBox.x + 15),
+               static_cast<int>(terroristBox.y + 200), 12, GOLD);
+    Text::Draw(terroristData.passiveName.c_str(), static_cast<int>(terroristBox.x + 15),
+               static_cast<int>(terroristBox.y + 215), 14, YELLOW);
+    Text::Draw(terroristData.passiveDescription.c_str(), static_cast<int>(terroristBox.x + 15),
+               static_cast<int>(terroristBox.y + 235), 11, LIGHTGRAY);
     
     // Lore
     DrawLine(static_cast<int>(terroristBox.x + 15), static_cast<int>(terroristBox.y + 270),
              static_cast<int>(terroristBox.x + boxWidth - 15), static_cast<int>(terroristBox.y + 270), GRAY);
-    DrawText("LORE:", static_cast<int>(terroristBox.x + 15),
-             static_cast<int>(terroristBox.y + 280), 12, Color{150, 150, 180, 255});
+    Text::Draw("LORE:", static_cast<int>(terroristBox.x + 15),
+               static_cast<int>(terroristBox.y + 280), 12, Color{150, 150, 180, 255});
     // Word wrap lore text (simple approach - split into lines)
     const char* lore1 = "Once a demolitions";
     const char* lore2 = "expert, now fights";
     const char* lore3 = "for glory in chaos.";
-    DrawText(lore1, static_cast<int>(terroristBox.x + 15), static_cast<int>(terroristBox.y + 298), 11, GRAY);
-    DrawText(lore2, static_cast<int>(terroristBox.x + 15), static_cast<int>(terroristBox.y + 312), 11, GRAY);
-    DrawText(lore3, static_cast<int>(terroristBox.x + 15), static_cast<int>(terroristBox.y + 326), 11, GRAY);
+    Text::Draw(lore1, static_cast<int>(terroristBox.x + 15), static_cast<int>(terroristBox.y + 298), 11, GRAY);
+    Text::Draw(lore2, static_cast<int>(terroristBox.x + 15), static_cast<int>(terroristBox.y + 312), 11, GRAY);
+    Text::Draw(lore3, static_cast<int>(terroristBox.x + 15), static_cast<int>(terroristBox.y + 326), 11, GRAY);
     
-    if (terroristHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+    if (terroristHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Game::Instance().SelectCharacter(CharacterType::TERRORIST);
     }
     
     // Character 2: Counter-Terrorist
     CharacterData ctData = Player::GetCharacterData(CharacterType::COUNTER_TERRORIST);
     Rectangle ctBox = {startX + boxWidth + spacing, y, boxWidth, boxHeight};
-    bool ctHovered = CheckCollisionPointRec(GetMousePosition(), ctBox);
+    bool ctHovered = CheckCollisionPointRec(Input::GetMousePosition(), ctBox);
     bool ctSelected = (selectedCharacter == CharacterType::COUNTER_TERRORIST);
     
     Color ctBg = ctSelected ? Color{50, 50, 80, 255} : 
@@ -505,44 +516,44 @@ void UIManager::RenderHub(CharacterType selectedCharacter) {
                static_cast<int>(ctBox.y + 50), 35, ctData.color);
     
     // Name
-    nameWidth = MeasureText(ctData.name.c_str(), 24);
-    DrawText(ctData.name.c_str(), 
-             static_cast<int>(ctBox.x + (boxWidth - nameWidth) / 2),
-             static_cast<int>(ctBox.y + 95), 24, WHITE);
+    nameWidth = Text::Measure(ctData.name.c_str(), 24);
+    Text::Draw(ctData.name.c_str(), 
+               static_cast<int>(ctBox.x + (boxWidth - nameWidth) / 2),
+               static_cast<int>(ctBox.y + 95), 24, WHITE);
     
     // Stats
     snprintf(statsText, sizeof(statsText), "HP: %d  Energy: %d", 
              ctData.stats.maxHealth, ctData.stats.maxEnergy);
-    DrawText(statsText, static_cast<int>(ctBox.x + 15),
-             static_cast<int>(ctBox.y + 130), 14, LIGHTGRAY);
-    DrawText("Weapon: Burst Rifle", static_cast<int>(ctBox.x + 15),
-             static_cast<int>(ctBox.y + 148), 14, LIGHTGRAY);
-    DrawText("Skill: Flashbang", static_cast<int>(ctBox.x + 15),
-             static_cast<int>(ctBox.y + 166), 14, SKYBLUE);
+    Text::Draw(statsText, static_cast<int>(ctBox.x + 15),
+               static_cast<int>(ctBox.y + 130), 14, LIGHTGRAY);
+    Text::Draw("Weapon: Burst Rifle", static_cast<int>(ctBox.x + 15),
+               static_cast<int>(ctBox.y + 148), 14, LIGHTGRAY);
+    Text::Draw("Skill: Flashbang", static_cast<int>(ctBox.x + 15),
+               static_cast<int>(ctBox.y + 166), 14, SKYBLUE);
     
     // Passive ability
     DrawLine(static_cast<int>(ctBox.x + 15), static_cast<int>(ctBox.y + 190),
              static_cast<int>(ctBox.x + boxWidth - 15), static_cast<int>(ctBox.y + 190), GRAY);
-    DrawText("PASSIVE:", static_cast<int>(ctBox.x + 15),
-             static_cast<int>(ctBox.y + 200), 12, GOLD);
-    DrawText(ctData.passiveName.c_str(), static_cast<int>(ctBox.x + 15),
-             static_cast<int>(ctBox.y + 215), 14, YELLOW);
-    DrawText(ctData.passiveDescription.c_str(), static_cast<int>(ctBox.x + 15),
-             static_cast<int>(ctBox.y + 235), 11, LIGHTGRAY);
+    Text::Draw("PASSIVE:", static_cast<int>(ctBox.x + 15),
+               static_cast<int>(ctBox.y + 200), 12, GOLD);
+    Text::Draw(ctData.passiveName.c_str(), static_cast<int>(ctBox.x + 15),
+               static_cast<int>(ctBox.y + 215), 14, YELLOW);
+    Text::Draw(ctData.passiveDescription.c_str(), static_cast<int>(ctBox.x + 15),
+               static_cast<int>(ctBox.y + 235), 11, LIGHTGRAY);
     
     // Lore
     DrawLine(static_cast<int>(ctBox.x + 15), static_cast<int>(ctBox.y + 270),
              static_cast<int>(ctBox.x + boxWidth - 15), static_cast<int>(ctBox.y + 270), GRAY);
-    DrawText("LORE:", static_cast<int>(ctBox.x + 15),
-             static_cast<int>(ctBox.y + 280), 12, Color{150, 150, 180, 255});
+    Text::Draw("LORE:", static_cast<int>(ctBox.x + 15),
+               static_cast<int>(ctBox.y + 280), 12, Color{150, 150, 180, 255});
     const char* ctLore1 = "Elite operative who";
     const char* ctLore2 = "lost her squad. Fights";
     const char* ctLore3 = "with precision.";
-    DrawText(ctLore1, static_cast<int>(ctBox.x + 15), static_cast<int>(ctBox.y + 298), 11, GRAY);
-    DrawText(ctLore2, static_cast<int>(ctBox.x + 15), static_cast<int>(ctBox.y + 312), 11, GRAY);
-    DrawText(ctLore3, static_cast<int>(ctBox.x + 15), static_cast<int>(ctBox.y + 326), 11, GRAY);
+    Text::Draw(ctLore1, static_cast<int>(ctBox.x + 15), static_cast<int>(ctBox.y + 298), 11, GRAY);
+    Text::Draw(ctLore2, static_cast<int>(ctBox.x + 15), static_cast<int>(ctBox.y + 312), 11, GRAY);
+    Text::Draw(ctLore3, static_cast<int>(ctBox.x + 15), static_cast<int>(ctBox.y + 326), 11, GRAY);
     
-    if (ctHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+    if (ctHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Game::Instance().SelectCharacter(CharacterType::COUNTER_TERRORIST);
     }
     
@@ -556,7 +567,7 @@ void UIManager::RenderHub(CharacterType selectedCharacter) {
         portalHeight
     };
     
-    bool portalHovered = CheckCollisionPointRec(GetMousePosition(), portalBox);
+    bool portalHovered = CheckCollisionPointRec(Input::GetMousePosition(), portalBox);
     
     // Animated portal glow
     float glowIntensity = (sinf(m_animTimer * 3.0f) + 1.0f) / 2.0f;
@@ -567,21 +578,21 @@ void UIManager::RenderHub(CharacterType selectedCharacter) {
                          portalHovered ? WHITE : VIOLET);
     
     const char* portalText = "ENTER";
-    int portalTextWidth = MeasureText(portalText, 24);
-    DrawText(portalText, 
-             static_cast<int>(portalBox.x + (portalWidth - portalTextWidth) / 2),
-             static_cast<int>(portalBox.y + (portalHeight - 24) / 2),
-             24, WHITE);
+    int portalTextWidth = Text::Measure(portalText, 24);
+    Text::Draw(portalText, 
+               static_cast<int>(portalBox.x + (portalWidth - portalTextWidth) / 2),
+               static_cast<int>(portalBox.y + (portalHeight - 24) / 2),
+               24, WHITE);
     
-    if (portalHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+    if (portalHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Game::Instance().EnterPortal();
     }
     
     // Hint at bottom
     const char* hintText = "Click a character to select, then click the portal to start your run";
-    int hintWidth = MeasureText(hintText, 14);
-    DrawText(hintText, (Game::SCREEN_WIDTH - hintWidth) / 2, 
-             Game::SCREEN_HEIGHT - 40, 14, GRAY);
+    int hintWidth = Text::Measure(hintText, 14);
+    Text::Draw(hintText, (Game::SCREEN_WIDTH - hintWidth) / 2, 
+               Game::SCREEN_HEIGHT - 40, 14, GRAY);
 }
 
 void UIManager::RenderRunResults(int score, int stage, int subLevel, CharacterType characterUsed) {
@@ -590,15 +601,15 @@ void UIManager::RenderRunResults(int score, int stage, int subLevel, CharacterTy
     
     // Title
     const char* title = "RUN COMPLETE";
-    int titleWidth = MeasureText(title, 50);
-    DrawText(title, (Game::SCREEN_WIDTH - titleWidth) / 2, 100, 50, RED);
+    int titleWidth = Text::Measure(title, 50);
+    Text::Draw(title, (Game::SCREEN_WIDTH - titleWidth) / 2, 100, 50, RED);
     
     // Character used
     CharacterData charData = Player::GetCharacterData(characterUsed);
     char charText[64];
     snprintf(charText, sizeof(charText), "Character: %s", charData.name.c_str());
-    int charWidth = MeasureText(charText, 24);
-    DrawText(charText, (Game::SCREEN_WIDTH - charWidth) / 2, 200, 24, LIGHTGRAY);
+    int charWidth = Text::Measure(charText, 24);
+    Text::Draw(charText, (Game::SCREEN_WIDTH - charWidth) / 2, 200, 24, LIGHTGRAY);
     
     // Stats box
     int boxWidth = 300;
@@ -612,27 +623,27 @@ void UIManager::RenderRunResults(int score, int stage, int subLevel, CharacterTy
     // Level reached
     char levelText[64];
     snprintf(levelText, sizeof(levelText), "Reached: Level %d-%d", stage, subLevel);
-    int levelWidth = MeasureText(levelText, 22);
-    DrawText(levelText, (Game::SCREEN_WIDTH - levelWidth) / 2, boxY + 30, 22, WHITE);
+    int levelWidth = Text::Measure(levelText, 22);
+    Text::Draw(levelText, (Game::SCREEN_WIDTH - levelWidth) / 2, boxY + 30, 22, WHITE);
     
     // Score
     char scoreText[64];
     snprintf(scoreText, sizeof(scoreText), "Currency Earned: %d", score);
-    int scoreWidth = MeasureText(scoreText, 22);
-    DrawText(scoreText, (Game::SCREEN_WIDTH - scoreWidth) / 2, boxY + 70, 22, GOLD);
+    int scoreWidth = Text::Measure(scoreText, 22);
+    Text::Draw(scoreText, (Game::SCREEN_WIDTH - scoreWidth) / 2, boxY + 70, 22, GOLD);
     
     // Encouragement
-    DrawText("Keep improving!", (Game::SCREEN_WIDTH - MeasureText("Keep improving!", 18)) / 2,
-             boxY + 110, 18, GRAY);
+    Text::Draw("Keep improving!", (Game::SCREEN_WIDTH - Text::Measure("Keep improving!", 18)) / 2,
+               boxY + 110, 18, GRAY);
     
     // Continue prompt
     float alpha = (sinf(m_animTimer * 3.0f) + 1.0f) / 2.0f;
     Color continueColor = ColorAlpha(WHITE, 0.5f + alpha * 0.5f);
     
     const char* continueText = "Press ENTER or SPACE to return to hub";
-    int continueWidth = MeasureText(continueText, 20);
-    DrawText(continueText, (Game::SCREEN_WIDTH - continueWidth) / 2, 
-             Game::SCREEN_HEIGHT - 100, 20, continueColor);
+    int continueWidth = Text::Measure(continueText, 20);
+    Text::Draw(continueText, (Game::SCREEN_WIDTH - continueWidth) / 2, 
+               Game::SCREEN_HEIGHT - 100, 20, continueColor);
 }
 
 void UIManager::RenderDebugMenu() {
@@ -642,12 +653,12 @@ void UIManager::RenderDebugMenu() {
     
     // Title
     const char* title = "DEBUG MENU";
-    int titleWidth = MeasureText(title, 40);
-    DrawText(title, (Game::SCREEN_WIDTH - titleWidth) / 2, 30, 40, RED);
+    int titleWidth = Text::Measure(title, 40);
+    Text::Draw(title, (Game::SCREEN_WIDTH - titleWidth) / 2, 30, 40, RED);
     
     const char* hint = "Press F1 to close";
-    int hintWidth = MeasureText(hint, 16);
-    DrawText(hint, (Game::SCREEN_WIDTH - hintWidth) / 2, 75, 16, GRAY);
+    int hintWidth = Text::Measure(hint, 16);
+    Text::Draw(hint, (Game::SCREEN_WIDTH - hintWidth) / 2, 75, 16, GRAY);
     
     int panelWidth = 280;
     int panelHeight = 520;
@@ -662,8 +673,8 @@ void UIManager::RenderDebugMenu() {
     DrawRectangleLines(weaponPanelX, panelY, panelWidth, panelHeight, PURPLE);
     
     const char* weaponsTitle = "WEAPONS";
-    int weaponsTitleW = MeasureText(weaponsTitle, 24);
-    DrawText(weaponsTitle, weaponPanelX + (panelWidth - weaponsTitleW) / 2, panelY + 15, 24, PURPLE);
+    int weaponsTitleW = Text::Measure(weaponsTitle, 24);
+    Text::Draw(weaponsTitle, weaponPanelX + (panelWidth - weaponsTitleW) / 2, panelY + 15, 24, PURPLE);
     
     const char* weaponNames[] = {"Pistol", "Shotgun", "SMG", "Magic Wand", "Heavy Cannon", "Burst Rifle"};
     Color weaponColors[] = {YELLOW, ORANGE, YELLOW, PURPLE, RED, ORANGE};
@@ -676,18 +687,18 @@ void UIManager::RenderDebugMenu() {
             45
         };
         
-        bool hovered = CheckCollisionPointRec(GetMousePosition(), btnRect);
+        bool hovered = CheckCollisionPointRec(Input::GetMousePosition(), btnRect);
         Color bgColor = hovered ? Color{80, 80, 120, 255} : Color{50, 50, 80, 255};
         
         DrawRectangleRec(btnRect, bgColor);
         DrawRectangleLinesEx(btnRect, 2, hovered ? weaponColors[i] : GRAY);
         
-        int nameW = MeasureText(weaponNames[i], 18);
-        DrawText(weaponNames[i], 
-                 static_cast<int>(btnRect.x + (btnRect.width - nameW) / 2),
-                 static_cast<int>(btnRect.y + 13), 18, WHITE);
+        int nameW = Text::Measure(weaponNames[i], 18);
+        Text::Draw(weaponNames[i], 
+                   static_cast<int>(btnRect.x + (btnRect.width - nameW) / 2),
+                   static_cast<int>(btnRect.y + 13), 18, WHITE);
         
-        if (hovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        if (hovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
             Game::Instance().DebugEquipWeapon(i);
         }
     }
@@ -698,8 +709,8 @@ void UIManager::RenderDebugMenu() {
     DrawRectangleLines(enemyPanelX, panelY, panelWidth, panelHeight, GREEN);
     
     const char* enemiesTitle = "ENEMIES";
-    int enemiesTitleW = MeasureText(enemiesTitle, 24);
-    DrawText(enemiesTitle, enemyPanelX + (panelWidth - enemiesTitleW) / 2, panelY + 15, 24, GREEN);
+    int enemiesTitleW = Text::Measure(enemiesTitle, 24);
+    Text::Draw(enemiesTitle, enemyPanelX + (panelWidth - enemiesTitleW) / 2, panelY + 15, 24, GREEN);
     
     const char* enemyNames[] = {"Slime", "Skeleton", "Bat", "Goblin", "Golem (Mini Boss)"};
     
@@ -711,18 +722,18 @@ void UIManager::RenderDebugMenu() {
             45
         };
         
-        bool hovered = CheckCollisionPointRec(GetMousePosition(), btnRect);
+        bool hovered = CheckCollisionPointRec(Input::GetMousePosition(), btnRect);
         Color bgColor = hovered ? Color{80, 120, 80, 255} : Color{50, 80, 50, 255};
         
         DrawRectangleRec(btnRect, bgColor);
         DrawRectangleLinesEx(btnRect, 2, hovered ? GREEN : GRAY);
         
-        int nameW = MeasureText(enemyNames[i], 18);
-        DrawText(enemyNames[i], 
-                 static_cast<int>(btnRect.x + (btnRect.width - nameW) / 2),
-                 static_cast<int>(btnRect.y + 13), 18, WHITE);
+        int nameW = Text::Measure(enemyNames[i], 18);
+        Text::Draw(enemyNames[i], 
+                   static_cast<int>(btnRect.x + (btnRect.width - nameW) / 2),
+                   static_cast<int>(btnRect.y + 13), 18, WHITE);
         
-        if (hovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        if (hovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
             Game::Instance().DebugSpawnEnemy(i);
         }
     }
@@ -735,17 +746,17 @@ void UIManager::RenderDebugMenu() {
         50
     };
     
-    bool clearHovered = CheckCollisionPointRec(GetMousePosition(), clearEnemiesBtn);
+    bool clearHovered = CheckCollisionPointRec(Input::GetMousePosition(), clearEnemiesBtn);
     DrawRectangleRec(clearEnemiesBtn, clearHovered ? Color{120, 60, 60, 255} : Color{80, 40, 40, 255});
     DrawRectangleLinesEx(clearEnemiesBtn, 2, clearHovered ? RED : MAROON);
     
     const char* clearText = "CLEAR ALL ENEMIES";
-    int clearW = MeasureText(clearText, 16);
-    DrawText(clearText, 
-             static_cast<int>(clearEnemiesBtn.x + (clearEnemiesBtn.width - clearW) / 2),
-             static_cast<int>(clearEnemiesBtn.y + 17), 16, WHITE);
+    int clearW = Text::Measure(clearText, 16);
+    Text::Draw(clearText, 
+               static_cast<int>(clearEnemiesBtn.x + (clearEnemiesBtn.width - clearW) / 2),
+               static_cast<int>(clearEnemiesBtn.y + 17), 16, WHITE);
     
-    if (clearHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+    if (clearHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Game::Instance().DebugClearEnemies();
     }
     
@@ -755,11 +766,11 @@ void UIManager::RenderDebugMenu() {
     DrawRectangleLines(controlPanelX, panelY, panelWidth, panelHeight, SKYBLUE);
     
     const char* controlsTitle = "GAME CONTROLS";
-    int controlsTitleW = MeasureText(controlsTitle, 24);
-    DrawText(controlsTitle, controlPanelX + (panelWidth - controlsTitleW) / 2, panelY + 15, 24, SKYBLUE);
+    int controlsTitleW = Text::Measure(controlsTitle, 24);
+    Text::Draw(controlsTitle, controlPanelX + (panelWidth - controlsTitleW) / 2, panelY + 15, 24, SKYBLUE);
     
     // Character selection sub-section
-    DrawText("Change Character:", controlPanelX + 20, panelY + 55, 18, WHITE);
+    Text::Draw("Change Character:", controlPanelX + 20, panelY + 55, 18, WHITE);
     
     // Terrorist button
     Rectangle terroristBtn = {
@@ -769,17 +780,17 @@ void UIManager::RenderDebugMenu() {
         45
     };
     
-    bool terroristHovered = CheckCollisionPointRec(GetMousePosition(), terroristBtn);
+    bool terroristHovered = CheckCollisionPointRec(Input::GetMousePosition(), terroristBtn);
     DrawRectangleRec(terroristBtn, terroristHovered ? Color{100, 60, 60, 255} : Color{70, 40, 40, 255});
     DrawRectangleLinesEx(terroristBtn, 2, terroristHovered ? Color{180, 80, 80, 255} : GRAY);
     
     const char* terroristText = "Terrorist";
-    int terroristW = MeasureText(terroristText, 18);
-    DrawText(terroristText, 
-             static_cast<int>(terroristBtn.x + (terroristBtn.width - terroristW) / 2),
-             static_cast<int>(terroristBtn.y + 13), 18, WHITE);
+    int terroristW = Text::Measure(terroristText, 18);
+    Text::Draw(terroristText, 
+               static_cast<int>(terroristBtn.x + (terroristBtn.width - terroristW) / 2),
+               static_cast<int>(terroristBtn.y + 13), 18, WHITE);
     
-    if (terroristHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+    if (terroristHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Game::Instance().DebugChangeCharacter(CharacterType::TERRORIST);
     }
     
@@ -791,17 +802,17 @@ void UIManager::RenderDebugMenu() {
         45
     };
     
-    bool ctHovered = CheckCollisionPointRec(GetMousePosition(), ctBtn);
+    bool ctHovered = CheckCollisionPointRec(Input::GetMousePosition(), ctBtn);
     DrawRectangleRec(ctBtn, ctHovered ? Color{60, 60, 100, 255} : Color{40, 40, 70, 255});
     DrawRectangleLinesEx(ctBtn, 2, ctHovered ? Color{80, 80, 180, 255} : GRAY);
     
     const char* ctText = "Counter-Terrorist";
-    int ctW = MeasureText(ctText, 18);
-    DrawText(ctText, 
-             static_cast<int>(ctBtn.x + (ctBtn.width - ctW) / 2),
-             static_cast<int>(ctBtn.y + 13), 18, WHITE);
+    int ctW = Text::Measure(ctText, 18);
+    Text::Draw(ctText, 
+               static_cast<int>(ctBtn.x + (ctBtn.width - ctW) / 2),
+               static_cast<int>(ctBtn.y + 13), 18, WHITE);
     
-    if (ctHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+    if (ctHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Game::Instance().DebugChangeCharacter(CharacterType::COUNTER_TERRORIST);
     }
     
@@ -809,7 +820,7 @@ void UIManager::RenderDebugMenu() {
     DrawLine(controlPanelX + 20, panelY + 210, controlPanelX + panelWidth - 20, panelY + 210, GRAY);
     
     // Quick actions
-    DrawText("Quick Actions:", controlPanelX + 20, panelY + 225, 18, WHITE);
+    Text::Draw("Quick Actions:", controlPanelX + 20, panelY + 225, 18, WHITE);
     
     // Restore Health button
     Rectangle healBtn = {
@@ -819,17 +830,17 @@ void UIManager::RenderDebugMenu() {
         45
     };
     
-    bool healHovered = CheckCollisionPointRec(GetMousePosition(), healBtn);
+    bool healHovered = CheckCollisionPointRec(Input::GetMousePosition(), healBtn);
     DrawRectangleRec(healBtn, healHovered ? Color{60, 100, 60, 255} : Color{40, 70, 40, 255});
     DrawRectangleLinesEx(healBtn, 2, healHovered ? GREEN : GRAY);
     
     const char* healText = "Restore Full Health";
-    int healW = MeasureText(healText, 16);
-    DrawText(healText, 
-             static_cast<int>(healBtn.x + (healBtn.width - healW) / 2),
-             static_cast<int>(healBtn.y + 14), 16, WHITE);
+    int healW = Text::Measure(healText, 16);
+    Text::Draw(healText, 
+               static_cast<int>(healBtn.x + (healBtn.width - healW) / 2),
+               static_cast<int>(healBtn.y + 14), 16, WHITE);
     
-    if (healHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+    if (healHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Player* player = Game::Instance().GetPlayer();
         if (player) {
             player->Heal(player->GetMaxHealth());
@@ -844,17 +855,17 @@ void UIManager::RenderDebugMenu() {
         45
     };
     
-    bool energyHovered = CheckCollisionPointRec(GetMousePosition(), energyBtn);
+    bool energyHovered = CheckCollisionPointRec(Input::GetMousePosition(), energyBtn);
     DrawRectangleRec(energyBtn, energyHovered ? Color{60, 60, 120, 255} : Color{40, 40, 80, 255});
     DrawRectangleLinesEx(energyBtn, 2, energyHovered ? BLUE : GRAY);
     
     const char* energyText = "Restore Full Energy";
-    int energyW = MeasureText(energyText, 16);
-    DrawText(energyText, 
-             static_cast<int>(energyBtn.x + (energyBtn.width - energyW) / 2),
-             static_cast<int>(energyBtn.y + 14), 16, WHITE);
+    int energyW = Text::Measure(energyText, 16);
+    Text::Draw(energyText, 
+               static_cast<int>(energyBtn.x + (energyBtn.width - energyW) / 2),
+               static_cast<int>(energyBtn.y + 14), 16, WHITE);
     
-    if (energyHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+    if (energyHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Player* player = Game::Instance().GetPlayer();
         if (player) {
             player->RestoreFullEnergy();
@@ -869,17 +880,17 @@ void UIManager::RenderDebugMenu() {
         45
     };
     
-    bool currencyHovered = CheckCollisionPointRec(GetMousePosition(), currencyBtn);
+    bool currencyHovered = CheckCollisionPointRec(Input::GetMousePosition(), currencyBtn);
     DrawRectangleRec(currencyBtn, currencyHovered ? Color{100, 90, 40, 255} : Color{70, 60, 30, 255});
     DrawRectangleLinesEx(currencyBtn, 2, currencyHovered ? GOLD : GRAY);
     
     const char* currencyText = "Add 100 Currency";
-    int currencyW = MeasureText(currencyText, 16);
-    DrawText(currencyText, 
-             static_cast<int>(currencyBtn.x + (currencyBtn.width - currencyW) / 2),
-             static_cast<int>(currencyBtn.y + 14), 16, WHITE);
+    int currencyW = Text::Measure(currencyText, 16);
+    Text::Draw(currencyText, 
+               static_cast<int>(currencyBtn.x + (currencyBtn.width - currencyW) / 2),
+               static_cast<int>(currencyBtn.y + 14), 16, WHITE);
     
-    if (currencyHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+    if (currencyHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Player* player = Game::Instance().GetPlayer();
         if (player) {
             player->AddRunCurrency(100);
@@ -897,18 +908,153 @@ void UIManager::RenderDebugMenu() {
         50
     };
     
-    bool endHovered = CheckCollisionPointRec(GetMousePosition(), endGameBtn);
+    bool endHovered = CheckCollisionPointRec(Input::GetMousePosition(), endGameBtn);
     DrawRectangleRec(endGameBtn, endHovered ? Color{150, 40, 40, 255} : Color{100, 30, 30, 255});
     DrawRectangleLinesEx(endGameBtn, 3, endHovered ? RED : MAROON);
     
     const char* endText = "END GAME";
-    int endW = MeasureText(endText, 20);
-    DrawText(endText, 
-             static_cast<int>(endGameBtn.x + (endGameBtn.width - endW) / 2),
-             static_cast<int>(endGameBtn.y + 15), 20, WHITE);
+    int endW = Text::Measure(endText, 20);
+    Text::Draw(endText, 
+               static_cast<int>(endGameBtn.x + (endGameBtn.width - endW) / 2),
+               static_cast<int>(endGameBtn.y + 15), 20, WHITE);
     
-    if (endHovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+    if (endHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Game::Instance().DebugEndGame();
         Game::Instance().ToggleDebugMenu();  // Close menu after ending game
     }
+    
+    // ========== DIAGNOSTICS ROW ==========
+    Profiler& profiler = Profiler::Instance();
+    bool profilerBuilt = Profiler::IsCompiledIn();
+    int rowY = panelY + panelHeight + 20;
+    int diagSpacing = 20;
+    int diagWidth = (totalWidth - 3 * diagSpacing) / 4;
+    
+    Rectangle overlayBtn = {
+        static_cast<float>(startX),
+        static_cast<float>(rowY),
+        static_cast<float>(diagWidth),
+        40
+    };
+    
+    bool overlayHovered = profilerBuilt && CheckCollisionPointRec(Input::GetMousePosition(), overlayBtn);
+    DrawRectangleRec(overlayBtn, overlayHovered ? Color{60, 90, 100, 255} : Color{40, 60, 70, 255});
+    DrawRectangleLinesEx(overlayBtn, 2, profiler.IsOverlayVisible() ? SKYBLUE : GRAY);
+    
+    const char* overlayText = !profilerBuilt ? "Profiler: not built" :
+                              profiler.IsOverlayVisible() ? "Profiler Overlay: ON" : "Profiler Overlay: OFF";
+    int overlayW = Text::Measure(overlayText, 16);
+    Text::Draw(overlayText, 
+               static_cast<int>(overlayBtn.x + (overlayBtn.width - overlayW) / 2),
+               static_cast<int>(overlayBtn.y + 12), 16, profilerBuilt ? WHITE : GRAY);
+    
+    if (overlayHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        profiler.ToggleOverlay();
+    }
+    
+    Rectangle traceBtn = {
+        static_cast<float>(startX + diagWidth + diagSpacing),
+        static_cast<float>(rowY),
+        static_cast<float>(diagWidth),
+        40
+    };
+    
+    bool traceHovered = profilerBuilt && CheckCollisionPointRec(Input::GetMousePosition(), traceBtn);
+    DrawRectangleRec(traceBtn, traceHovered ? Color{60, 90, 100, 255} : Color{40, 60, 70, 255});
+    DrawRectangleLinesEx(traceBtn, 2, traceHovered ? SKYBLUE : GRAY);
+    
+    const char* traceText = "Save Trace (F9)";
+    int traceW = Text::Measure(traceText, 16);
+    Text::Draw(traceText, 
+               static_cast<int>(traceBtn.x + (traceBtn.width - traceW) / 2),
+               static_cast<int>(traceBtn.y + 12), 16, profilerBuilt ? WHITE : GRAY);
+    
+    if (traceHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        Game::Instance().SaveProfilerTrace();
+    }
+    
+    DungeonManager* dungeon = Game::Instance().GetDungeon();
+    Rectangle cacheBtn = {
+        static_cast<float>(startX + 2 * (diagWidth + diagSpacing)),
+        static_cast<float>(rowY),
+        static_cast<float>(diagWidth),
+        40
+    };
+    
+    bool cacheHovered = dungeon && CheckCollisionPointRec(Input::GetMousePosition(), cacheBtn);
+    bool cacheOn = dungeon && dungeon->IsTileCacheEnabled();
+    DrawRectangleRec(cacheBtn, cacheHovered ? Color{60, 90, 100, 255} : Color{40, 60, 70, 255});
+    DrawRectangleLinesEx(cacheBtn, 2, cacheOn ? SKYBLUE : GRAY);
+    
+    const char* cacheText = cacheOn ? "Room Tile Cache: ON" : "Room Tile Cache: OFF";
+    int cacheW = Text::Measure(cacheText, 16);
+    Text::Draw(cacheText, 
+               static_cast<int>(cacheBtn.x + (cacheBtn.width - cacheW) / 2),
+               static_cast<int>(cacheBtn.y + 12), 16, WHITE);
+    
+    if (cacheHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        dungeon->SetTileCacheEnabled(!cacheOn);
+    }
+    
+    TextCache& textCache = TextCache::Instance();
+    Rectangle textBtn = {
+        static_cast<float>(startX + 3 * (diagWidth + diagSpacing)),
+        static_cast<float>(rowY),
+        static_cast<float>(diagWidth),
+        40
+    };
+    
+    bool textHovered = CheckCollisionPointRec(Input::GetMousePosition(), textBtn);
+    DrawRectangleRec(textBtn, textHovered ? Color{60, 90, 100, 255} : Color{40, 60, 70, 255});
+    DrawRectangleLinesEx(textBtn, 2, textCache.IsEnabled() ? SKYBLUE : GRAY);
+    
+    const char* textCacheText = textCache.IsEnabled() ? "Text Cache: ON" : "Text Cache: OFF";
+    int textCacheW = Text::Measure(textCacheText, 16);
+    Text::Draw(textCacheText, 
+               static_cast<int>(textBtn.x + (textBtn.width - textCacheW) / 2),
+               static_cast<int>(textBtn.y + 12), 16, WHITE);
+    
+    if (textHovered && Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        textCache.SetEnabled(!textCache.IsEnabled());
+    }
+}
+
+void UIManager::RenderProfilerOverlay() {
+    const Profiler& profiler = Profiler::Instance();
+    const auto& stats = profiler.GetFrameStats();
+    const auto& counters = profiler.GetFrameCounters();
+    
+    const int lineHeight = 16;
+    const int width = 330;
+    int height = 34 + static_cast<int>(stats.size() + counters.size()) * lineHeight;
+    int x = Game::SCREEN_WIDTH - width - 10;
+    int y = 10;
+    
+    DrawRectangle(x, y, width, height, ColorAlpha(BLACK, 0.75f));
+    DrawRectangleLines(x, y, width, height, SKYBLUE);
+    
+    // Readings change every frame; caching them would only churn the text
+    // cache, so they go straight to raylib. Labels are stable and cached.
+    DrawText(TextFormat("Frame %.2f ms (%d FPS)", profiler.GetFrameMs(), GetFPS()), 
+             x + 8, y + 8, 16, SKYBLUE);
+    
+    // Zones in start order, children indented under their parents
+    int lineY = y + 30;
+    for (const Profiler::ZoneStat& stat : stats) {
+        Text::Draw(stat.name, x + 8 + stat.depth * 12, lineY, 14, WHITE);
+        
+        const char* timing = stat.calls > 1 ? TextFormat("%6.3f ms x%d", stat.avgMs, stat.calls) :
+                                              TextFormat("%6.3f ms", stat.avgMs);
+        DrawText(timing, x + width - 8 - MeasureText(timing, 14), lineY, 14, 
+                 stat.avgMs > 4.0f ? ORANGE : LIGHTGRAY);
+        lineY += lineHeight;
+    }
+    
+    for (const Profiler::CounterStat& counter : counters) {
+        Text::Draw(counter.name, x + 8, lineY, 14, SKYBLUE);
+        
+        const char* value = TextFormat("%lld", counter.value);
+        DrawText(value, x + width - 8 - MeasureText(value, 14), lineY, 14, LIGHTGRAY);
+        lineY += lineHeight;
+    }
 }
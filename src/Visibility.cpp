@@ -0,0 +1,118 @@
+#include "Visibility.hpp"
+#include "Dungeon.hpp"
+#include <cmath>
+#include <limits>
+
+// ============================================================================
+// Grid traversal
+// ============================================================================
+namespace {
+    // Walk the tiles crossed by the segment (x0,y0)-(x1,y1), given in tile
+    // units relative to the room origin
+    bool TraverseTiles(const Room& room, float x0, float y0, float x1, float y1) {
+        int tileX = static_cast<int>(std::floor(x0));
+        int tileY = static_cast<int>(std::floor(y0));
+        const int endX = static_cast<int>(std::floor(x1));
+        const int endY = static_cast<int>(std::floor(y1));
+        
+        if (!room.IsWalkable(tileX, tileY)) return false;
+        
+        const float dx = x1 - x0;
+        const float dy = y1 - y0;
+        const int stepX = dx > 0.0f ? 1 : (dx < 0.0f ? -1 : 0);
+        const int stepY = dy > 0.0f ? 1 : (dy < 0.0f ? -1 : 0);
+        
+        // Parametric distance (0..1 along the segment) to the next vertical
+        // and horizontal grid line, and between successive lines
+        const float inf = std::numeric_limits<float>::infinity();
+        const float deltaX = stepX != 0 ? 1.0f / std::fabs(dx) : inf;
+        const float deltaY = stepY != 0 ? 1.0f / std::fabs(dy) : inf;
+        float maxX = stepX > 0 ? (tileX + 1 - x0) * deltaX : (stepX < 0 ? (x0 - tileX) * deltaX : inf);
+        float maxY = stepY > 0 ? (tileY + 1 - y0) * deltaY : (stepY < 0 ? (y0 - tileY) * deltaY : inf);
+        
+        // Never more steps than the Manhattan tile distance
+        int remaining = std::abs(endX - tileX) + std::abs(endY - tileY);
+        
+        while (remaining > 0 && (tileX != endX || tileY != endY)) {
+            if (maxX < maxY) {
+                tileX += stepX;
+                maxX += deltaX;
+                --remaining;
+            } else if (maxY < maxX) {
+                tileY += stepY;
+                maxY += deltaY;
+                --remaining;
+            } else {
+                // Exactly through a corner - don't squeeze between two tiles
+                if (!room.IsWalkable(tileX + stepX, tileY) || !room.IsWalkable(tileX, tileY + stepY)) {
+                    return false;
+                }
+                tileX += stepX;
+                tileY += stepY;
+                maxX += deltaX;
+                maxY += deltaY;
+                remaining -= 2;
+            }
+            
+            if (!room.IsWalkable(tileX, tileY)) return false;
+        }
+        
+        return true;
+    }
+}
+
+bool Visibility::Raycast(const Room& room, Vector2 from, Vector2 to) {
+    Vector2 origin = room.GetWorldPosition();
+    const float invTile = 1.0f / Room::TILE_SIZE;
+    return TraverseTiles(room,
+        (from.x - origin.x) * invTile, (from.y - origin.y) * invTile,
+        (to.x - origin.x) * invTile, (to.y - origin.y) * invTile);
+}
+
+bool Visibility::Raycast(const Room& room, int fromX, int fromY, int toX, int toY) {
+    return TraverseTiles(room, fromX + 0.5f, fromY + 0.5f, toX + 0.5f, toY + 0.5f);
+}
+
+bool Visibility::HasLineOfSight(const Room& room, Vector2 from, Vector2 to) {
+    const VisibilityTable& table = room.GetVisibility();
+    
+    int fromX, fromY, toX, toY;
+    if (table.IsBuilt() && room.WorldToTile(from, fromX, fromY) && room.WorldToTile(to, toX, toY)) {
+        return table.IsVisible(fromY * Room::WIDTH + fromX, toY * Room::WIDTH + toX);
+    }
+    
+    return Raycast(room, from, to);
+}
+
+// ============================================================================
+// Visibility Table
+// ============================================================================
+void VisibilityTable::Build(const Room& room) {
+    m_tileCount = Room::WIDTH * Room::HEIGHT;
+    m_bits.assign((m_tileCount * m_tileCount + 63) / 64, 0);
+    
+    auto setBit = [this](int from, int to) {
+        uint32_t bit = static_cast<uint32_t>(from * m_tileCount + to);
+        m_bits[bit >> 6] |= uint64_t(1) << (bit & 63);
+    };
+    
+    // Traversal is symmetric, so only cast each unordered pair once.
+    // Pairs involving a blocked tile stay 0.
+    for (int a = 0; a < m_tileCount; ++a) {
+        int ax = a % Room::WIDTH;
+        int ay = a / Room::WIDTH;
+        if (!room.IsWalkable(ax, ay)) continue;
+        
+        setBit(a, a);
+        for (int b = a + 1; b < m_tileCount; ++b) {
+            int bx = b % Room::WIDTH;
+            int by = b / Room::WIDTH;
+            if (!room.IsWalkable(bx, by)) continue;
+            
+            if (Visibility::Raycast(room, ax, ay, bx, by)) {
+                setBit(a, b);
+                setBit(b, a);
+            }
+        }
+    }
+}
@@ -0,0 +1,127 @@
+// ============================================================================
+// Asset load benchmark
+// Startup sprite loading through the loose-file path (probe + PNG decode per
+// sprite, what SpriteManager does without a pack) against the baked pack
+// (map, look up, touch every page of pixels). One synthetic 128x128 image per
+// SpriteType is written to a temp directory first. Files are read from a warm
+// OS cache, which is what a relaunch sees; a cold disk only adds to the loose
+// path's per-file cost.
+// ============================================================================
+#include "Benchmarks.hpp"
+#include "AssetPack.hpp"
+#include "SpriteManager.hpp"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr int SPRITE_COUNT = static_cast<int>(SpriteType::COUNT);
+    constexpr int IMAGE_SIZE = 128;
+
+    // Blocky shapes with a little noise: compresses like real pixel art, not
+    // like a flat fill
+    Image MakeImage(std::mt19937& rng) {
+        Image image = GenImageColor(IMAGE_SIZE, IMAGE_SIZE, BLANK);
+        Color* pixels = static_cast<Color*>(image.data);
+        std::uniform_int_distribution<int> channel(0, 255);
+        std::uniform_int_distribution<int> noise(0, 15);
+        Color palette[4];
+        for (Color& color : palette) {
+            color = {static_cast<unsigned char>(channel(rng)), static_cast<unsigned char>(channel(rng)),
+                     static_cast<unsigned char>(channel(rng)), 255};
+        }
+        for (int y = 0; y < IMAGE_SIZE; ++y) {
+            for (int x = 0; x < IMAGE_SIZE; ++x) {
+                Color color = palette[((x / 16) + (y / 16) * 3) % 4];
+                color.r = static_cast<unsigned char>(color.r ^ noise(rng));
+                pixels[y * IMAGE_SIZE + x] = color;
+            }
+        }
+        return image;
+    }
+
+    template <typename Fn>
+    void Report(const char* label, int rounds, Fn&& load) {
+        long long checksum = 0;
+        int loaded = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; ++round) {
+            loaded = load(checksum);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printf("%-10s %12.3f %10d %14lld\n", label, seconds * 1e3 / rounds, loaded, checksum);
+    }
+}
+
+int Benchmarks::RunAssetLoad() {
+    fs::path directory = fs::temp_directory_path() / "epitome_asset_bench";
+    fs::create_directories(directory);
+    const std::string prefix = directory.string() + "/";
+    const std::string packPath = prefix + "sprites.pak";
+
+    std::mt19937 rng(11);
+    std::vector<AssetPack::Source> sources;
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        SpriteType type = static_cast<SpriteType>(i);
+        Image image = MakeImage(rng);
+        ExportImage(image, (prefix + SpriteManager::GetDefaultFilename(type)).c_str());
+        sources.push_back({SpriteManager::GetSpriteName(type), image});
+    }
+    bool written = AssetPack::Write(packPath, sources);
+    for (AssetPack::Source& source : sources) {
+        UnloadImage(source.image);
+    }
+    if (!written) return 1;
+
+    const int rounds = 20;
+    int looseCount = 0;
+    int packCount = 0;
+    printf("%-10s %12s %10s %14s\n", "", "ms/load", "sprites", "checksum");
+
+    Report("loose", rounds, [&](long long& checksum) {
+        looseCount = 0;
+        for (int i = 0; i < SPRITE_COUNT; ++i) {
+            std::string path = prefix + SpriteManager::GetDefaultFilename(static_cast<SpriteType>(i));
+            if (!FileExists(path.c_str())) continue;
+            Image image = LoadImage(path.c_str());
+            if (!image.data) continue;
+            checksum += static_cast<const unsigned char*>(image.data)[0];
+            UnloadImage(image);
+            ++looseCount;
+        }
+        return looseCount;
+    });
+
+    Report("pack", rounds, [&](long long& checksum) {
+        packCount = 0;
+        AssetPackReader pack;
+        if (!pack.Open(packPath)) return 0;
+        for (int i = 0; i < SPRITE_COUNT; ++i) {
+            const AssetPack::Entry* entry = pack.Find(SpriteManager::GetSpriteName(static_cast<SpriteType>(i)));
+            if (!entry) continue;
+            // Fault every page in, as the texture upload would
+            Image image = pack.GetImage(*entry);
+            const unsigned char* bytes = static_cast<const unsigned char*>(image.data);
+            for (size_t offset = 0; offset < entry->size; offset += 4096) {
+                checksum += bytes[offset];
+            }
+            ++packCount;
+        }
+        return packCount;
+    });
+
+    std::error_code ignored;
+    fs::remove_all(directory, ignored);
+
+    // The pack must hold every sprite the directory does
+    if (packCount != SPRITE_COUNT || looseCount != SPRITE_COUNT) {
+        printf("MISMATCH: loose %d, pack %d, expected %d\n", looseCount, packCount, SPRITE_COUNT);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+// ============================================================================
+// Broadphase benchmark
+// Compares the old all-pairs projectile/enemy scan with the SpatialGrid query
+// used by Game::CheckCollisions, on synthetic crowds of increasing size.
+// ============================================================================
+#include "Benchmarks.hpp"
+#include "SpatialGrid.hpp"
+#include "Dungeon.hpp"
+#include "raymath.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    struct Circle {
+        Vector2 pos;
+        float radius;
+    };
+
+    bool Overlaps(const Circle& a, const Circle& b) {
+        float reach = a.radius + b.radius;
+        return Vector2DistanceSqr(a.pos, b.pos) < reach * reach;
+    }
+
+    // First enemy hit by each projectile, all-pairs
+    long long BruteForce(const std::vector<Circle>& enemies, const std::vector<Circle>& projectiles) {
+        long long hits = 0;
+        for (const Circle& proj : projectiles) {
+            for (size_t i = 0; i < enemies.size(); ++i) {
+                if (Overlaps(proj, enemies[i])) {
+                    hits += static_cast<long long>(i) + 1;
+                    break;
+                }
+            }
+        }
+        return hits;
+    }
+
+    // Same result through the grid, including the per-frame rebuild
+    long long Grid(SpatialGrid& grid, const std::vector<Circle>& enemies,
+                   const std::vector<Circle>& projectiles) {
+        grid.Clear();
+        for (size_t i = 0; i < enemies.size(); ++i) {
+            grid.Insert(static_cast<int>(i), enemies[i].pos, enemies[i].radius);
+        }
+        grid.Build();
+
+        long long hits = 0;
+        for (const Circle& proj : projectiles) {
+            int hitIndex = -1;
+            grid.ForEachCandidate(proj.pos, proj.radius, [&](int index) {
+                if (hitIndex != -1 && index > hitIndex) return;
+                if (Overlaps(proj, enemies[index])) hitIndex = index;
+            });
+            if (hitIndex != -1) hits += hitIndex + 1;
+        }
+        return hits;
+    }
+
+    template <typename Fn>
+    double TimeMs(int iterations, Fn&& fn) {
+        using Clock = std::chrono::steady_clock;
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; ++i) fn();
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+    }
+}
+
+int Benchmarks::RunBroadphase() {
+    struct Scale { int enemies; int projectiles; };
+    const Scale scales[] = {{10, 100}, {100, 1000}, {1000, 10000}};
+
+    // Spread over a room-sized area per ~30 enemies so density stays game-like
+    std::mt19937 rng(1234);
+    SpatialGrid grid(static_cast<float>(Room::TILE_SIZE));
+    bool consistent = true;
+
+    printf("%9s %12s %14s %14s %9s\n", "enemies", "projectiles", "brute ms/frm", "grid ms/frm", "speedup");
+
+    for (const Scale& scale : scales) {
+        float side = Room::TILE_SIZE * Room::WIDTH * std::sqrt(scale.enemies / 30.0f + 1.0f);
+        std::uniform_real_distribution<float> coord(0.0f, side);
+        std::uniform_real_distribution<float> enemyRadius(12.0f, 28.0f);
+
+        std::vector<Circle> enemies(scale.enemies);
+        for (Circle& e : enemies) e = {{coord(rng), coord(rng)}, enemyRadius(rng)};
+        std::vector<Circle> projectiles(scale.projectiles);
+        for (Circle& p : projectiles) p = {{coord(rng), coord(rng)}, 6.0f};
+
+        long long bruteHits = 0;
+        long long gridHits = 0;
+        int iterations = scale.enemies >= 1000 ? 5 : 200;
+        double bruteMs = TimeMs(iterations, [&] { bruteHits = BruteForce(enemies, projectiles); });
+        double gridMs = TimeMs(iterations, [&] { gridHits = Grid(grid, enemies, projectiles); });
+
+        printf("%9d %12d %14.4f %14.4f %8.1fx%s\n", scale.enemies, scale.projectiles,
+               bruteMs, gridMs, gridMs > 0.0 ? bruteMs / gridMs : 0.0,
+               bruteHits == gridHits ? "" : "  MISMATCH");
+        consistent = consistent && bruteHits == gridHits;
+    }
+
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+// ============================================================================
+// Crowd steering benchmark
+// Times EnemyManager::Update with crowd separation off and on for crowds of
+// increasing size in the first room of a headless run (same spawn layout and
+// RNG seed for both passes), and counts how many enemy pairs are still
+// stacked - centres closer than the larger radius - after the run. The
+// per-enemy cost of separation should stay flat as the room fills up, since
+// each neighbour query is capped.
+// ============================================================================
+#include "Benchmarks.hpp"
+#include "Game.hpp"
+#include "Enemy.hpp"
+#include "Dungeon.hpp"
+#include "Projectile.hpp"
+#include "Pathfinding.hpp"
+#include "SpatialGrid.hpp"
+#include "Utils.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+    // Pairs whose centres are closer than the larger of the two radii
+    long long CountStackedPairs(const EnemyManager& enemies) {
+        SpatialGrid grid(static_cast<float>(Room::TILE_SIZE));
+        for (int i = 0; i < enemies.GetCount(); ++i) {
+            grid.Insert(i, enemies.GetPosition(i), enemies.GetRadius(i));
+        }
+        grid.Build();
+
+        long long stacked = 0;
+        for (int i = 0; i < enemies.GetCount(); ++i) {
+            Vector2 pos = enemies.GetPosition(i);
+            grid.ForEachCandidate(pos, enemies.GetRadius(i), [&](int j) {
+                if (j <= i) return;
+                float limit = std::max(enemies.GetRadius(i), enemies.GetRadius(j));
+                if (Vector2DistanceSqr(pos, enemies.GetPosition(j)) < limit * limit) ++stacked;
+            });
+        }
+        return stacked;
+    }
+}
+
+int Benchmarks::RunCrowd() {
+    const int counts[] = {50, 200, 1000, 5000};
+    const int warmupFrames = 30;
+    const int frames = 120;
+    const float dt = 1.0f / 60.0f;
+
+    const std::vector<Vector2> spawnPoints = SetUpEnemyRoom();
+    Game& game = Game::Instance();
+    EnemyManager* enemies = game.GetEnemies();
+
+    printf("%10s %8s %14s %12s %16s %16s\n", "enemies", "crowd", "update ms/frm", "us/enemy",
+           "crowd us/enemy", "stacked pairs");
+
+    for (int count : counts) {
+        double offUsPerEnemy = 0.0;
+        for (bool separate : {false, true}) {
+            enemies->Clear();
+            enemies->crowd.enabled = separate;
+            Utils::SeedRNG(1234);
+            SpawnCrowd(*enemies, spawnPoints, count, 7);
+
+            double totalMs = 0.0;
+            for (int frame = 0; frame < warmupFrames + frames; ++frame) {
+                PathRequestQueue::Instance().BeginFrame();
+                auto start = std::chrono::steady_clock::now();
+                enemies->Update(dt);
+                double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                if (frame >= warmupFrames) totalMs += ms;
+                game.GetProjectiles()->Clear();
+            }
+
+            double usPerEnemy = totalMs * 1000.0 / frames / count;
+            if (!separate) offUsPerEnemy = usPerEnemy;
+
+            printf("%10d %8s %14.4f %12.4f %16s %16lld\n", count, separate ? "on" : "off", totalMs / frames,
+                   usPerEnemy, separate ? TextFormat("%.4f", usPerEnemy - offUsPerEnemy) : "-",
+                   CountStackedPairs(*enemies));
+        }
+    }
+
+    enemies->crowd = EnemyCrowdSteering();
+
+    enemies->Clear();
+    game.Shutdown();
+    return 0;
+}
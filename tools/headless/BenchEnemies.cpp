@@ -0,0 +1,82 @@
+// ============================================================================
+// Enemy update benchmark
+// Times EnemyManager::Update (AI, line of sight, flow field and path
+// following, dead-enemy compaction) for crowds of increasing size packed into
+// the first room of a headless run, once with every enemy thinking every tick
+// and once with the AI think scheduler. Both passes start from the same
+// spawn layout. The second set of rows moves the player out of the room,
+// leaving every enemy idle and beyond nearDistance - the case the scheduler
+// is for. Enemy projectiles are cleared between frames, outside the
+// timed section.
+// ============================================================================
+#include "Benchmarks.hpp"
+#include "Game.hpp"
+#include "Enemy.hpp"
+#include "Player.hpp"
+#include "Dungeon.hpp"
+#include "Projectile.hpp"
+#include "Pathfinding.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+int Benchmarks::RunEnemies() {
+    const int counts[] = {500, 1000, 5000};
+    const int warmupFrames = 30;
+    const int frames = 120;
+    const float dt = 1.0f / 60.0f;
+
+    const std::vector<Vector2> spawnPoints = SetUpEnemyRoom();
+    Game& game = Game::Instance();
+    EnemyManager* enemies = game.GetEnemies();
+    Vector2 roomPos = game.GetDungeon()->GetCurrentRoom()->GetWorldPosition();
+
+    Player* player = game.GetPlayer();
+    const Vector2 playerStart = player->GetPosition();
+
+    printf("%8s %10s %8s %14s %14s %12s %14s %12s\n", "player", "enemies", "ai lod", "update ms/frm", "us/enemy",
+           "thinks/frm", "allocs/frm", "alive at end");
+
+    for (bool away : {false, true}) {
+        player->SetPosition(away ? Vector2{roomPos.x - 2000.0f, roomPos.y} : playerStart);
+        for (int count : counts) {
+            for (bool lod : {false, true}) {
+                enemies->Clear();
+                enemies->aiSchedule.enabled = lod;
+                SpawnCrowd(*enemies, spawnPoints, count, 7);
+
+                double totalMs = 0.0;
+                long long allocations = 0;
+                long long thinks = 0;
+                for (int frame = 0; frame < warmupFrames + frames; ++frame) {
+                    long long allocsBefore = GetAllocationCount();
+                    PathRequestQueue::Instance().BeginFrame();
+                    auto start = std::chrono::steady_clock::now();
+                    enemies->Update(dt);
+                    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                    long long allocs = GetAllocationCount() - allocsBefore;
+
+                    if (frame >= warmupFrames) {
+                        const EnemyAIStats& stats = enemies->GetAIStats();
+                        totalMs += ms;
+                        allocations += allocs;
+                        thinks += stats.fullRate + stats.scheduled;
+                    }
+                    game.GetProjectiles()->Clear();
+                }
+
+                printf("%8s %10d %8s %14.4f %14.4f %12.1f %14.1f %12d\n", away ? "away" : "in room", count,
+                       lod ? "on" : "off", totalMs / frames, totalMs * 1000.0 / frames / count,
+                       static_cast<double>(thinks) / frames,
+                       static_cast<double>(allocations) / frames, enemies->GetActiveCount());
+            }
+        }
+    }
+    player->SetPosition(playerStart);
+
+    enemies->aiSchedule = EnemyAISchedule();
+
+    enemies->Clear();
+    game.Shutdown();
+    return 0;
+}
@@ -0,0 +1,97 @@
+// ============================================================================
+// Enemy update thread scaling
+// Runs the same 10k-enemy crowd (one room of a headless run, fixed spawn
+// layout and RNG seed) through EnemyManager::Update with the JobSystem at 1,
+// 2, 4 and 8 threads. Every row must end in the same state - the positions
+// are hashed and compared - since the parallel pass defers its side effects
+// and applies them in slot order. On a machine with fewer cores the higher
+// rows only show the cost of oversubscription.
+// ============================================================================
+#include "Benchmarks.hpp"
+#include "Game.hpp"
+#include "Enemy.hpp"
+#include "Projectile.hpp"
+#include "Pathfinding.hpp"
+#include "JobSystem.hpp"
+#include "Utils.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+int Benchmarks::RunEnemyScaling() {
+    const int enemyCount = 10000;
+    const int threadCounts[] = {1, 2, 4, 8};
+    const int warmupFrames = 30;
+    const int frames = 120;
+    const float dt = 1.0f / 60.0f;
+
+    const std::vector<Vector2> spawnPoints = SetUpEnemyRoom();
+    Game& game = Game::Instance();
+
+    printf("%d enemies, %u hardware threads\n", enemyCount, std::thread::hardware_concurrency());
+    printf("%8s %14s %10s %14s %18s\n", "threads", "update ms/frm", "speedup", "steals/frm", "state hash");
+
+    double baselineMs = 0.0;
+    uint64_t baselineHash = 0;
+    bool consistent = true;
+
+    for (int threads : threadCounts) {
+        JobSystem::Instance().Start(threads - 1);
+        Utils::SeedRNG(1234);
+        game.GetProjectiles()->Clear();
+
+        // A fresh manager per row so ids and scheduler phase line up
+        EnemyManager enemies;
+        SpawnCrowd(enemies, spawnPoints, enemyCount, 7);
+
+        double totalMs = 0.0;
+        long long steals = 0;
+        for (int frame = 0; frame < warmupFrames + frames; ++frame) {
+            PathRequestQueue::Instance().BeginFrame();
+            auto start = std::chrono::steady_clock::now();
+            enemies.Update(dt);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            if (frame >= warmupFrames) {
+                totalMs += ms;
+                steals += JobSystem::Instance().GetStealsLastRun();
+            }
+            game.GetProjectiles()->Clear();
+        }
+
+        // FNV-1a over every enemy's position and health
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](const void* data, size_t size) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (size_t b = 0; b < size; ++b) {
+                hash = (hash ^ bytes[b]) * 1099511628211ull;
+            }
+        };
+        for (int i = 0; i < enemies.GetCount(); ++i) {
+            Vector2 pos = enemies.GetPosition(i);
+            int health = enemies.GetHealth(i);
+            mix(&pos, sizeof(pos));
+            mix(&health, sizeof(health));
+        }
+        enemies.Clear();
+
+        double ms = totalMs / frames;
+        if (threads == 1) {
+            baselineMs = ms;
+            baselineHash = hash;
+        }
+        consistent = consistent && hash == baselineHash;
+
+        printf("%8d %14.4f %9.2fx %14.1f %18llx\n", threads, ms, baselineMs / ms,
+               static_cast<double>(steals) / frames, static_cast<unsigned long long>(hash));
+    }
+
+    if (!consistent) {
+        printf("MISMATCH: the end state depends on the thread count\n");
+    }
+
+    game.Shutdown();
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,280 @@
+// ============================================================================
+// Pathfinding benchmark
+// Runs the same batch of A* queries through the previous implementation
+// (priority_queue + unordered_maps + per-expansion neighbor vectors, kept
+// here as a baseline) and the current Pathfinder, reporting throughput and
+// heap allocations per query. Also checks that a path callback can cancel,
+// destroy or restart other seekers whose results are already waiting to be
+// delivered in the same PathRequestQueue::Update(), and that catch-up ticks
+// within one frame share that frame's search budget.
+// ============================================================================
+#include "Benchmarks.hpp"
+#include "Pathfinding.hpp"
+#include "Dungeon.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <queue>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    // Baseline: the original search, minus modifiers and traversal providers
+    struct LegacyNode {
+        int x, y;
+        float gCost;
+        float hCost;
+        float fCost() const { return gCost + hCost; }
+        int parentX, parentY;
+        bool operator>(const LegacyNode& other) const { return fCost() > other.fCost(); }
+    };
+
+    std::vector<std::pair<int, int>> LegacyNeighbors(Room* room, int x, int y) {
+        std::vector<std::pair<int, int>> neighbors;
+        const int dx[] = {-1, 0, 1, -1, 1, -1, 0, 1};
+        const int dy[] = {-1, -1, -1, 0, 0, 1, 1, 1};
+        for (int i = 0; i < 8; ++i) {
+            int nx = x + dx[i];
+            int ny = y + dy[i];
+            if (!room->IsWalkable(nx, ny)) continue;
+            if (dx[i] != 0 && dy[i] != 0 &&
+                (!room->IsWalkable(x + dx[i], y) || !room->IsWalkable(x, y + dy[i]))) {
+                continue;
+            }
+            neighbors.push_back({nx, ny});
+        }
+        return neighbors;
+    }
+
+    Path LegacyFindPath(Room* room, Vector2 startWorld, Vector2 goalWorld) {
+        Path result;
+        int startX, startY, goalX, goalY;
+        if (!room->WorldToTile(startWorld, startX, startY) || !room->WorldToTile(goalWorld, goalX, goalY) ||
+            !room->IsWalkable(startX, startY) || !room->IsWalkable(goalX, goalY)) {
+            result.error = true;
+            return result;
+        }
+        if (startX == goalX && startY == goalY) return result;
+
+        auto heuristic = [](int x1, int y1, int x2, int y2) {
+            float dx = static_cast<float>(x2 - x1);
+            float dy = static_cast<float>(y2 - y1);
+            return std::sqrt(dx * dx + dy * dy);
+        };
+        auto hashCoord = [](int x, int y) { return y * 10000 + x; };
+
+        std::priority_queue<LegacyNode, std::vector<LegacyNode>, std::greater<LegacyNode>> openSet;
+        std::unordered_map<int, LegacyNode> allNodes;
+        std::unordered_map<int, bool> closedSet;
+
+        LegacyNode startNode{startX, startY, 0.0f, heuristic(startX, startY, goalX, goalY), -1, -1};
+        openSet.push(startNode);
+        allNodes[hashCoord(startX, startY)] = startNode;
+
+        int iterations = 0;
+        while (!openSet.empty() && iterations < 1000) {
+            ++iterations;
+            LegacyNode current = openSet.top();
+            openSet.pop();
+
+            int currentHash = hashCoord(current.x, current.y);
+            if (closedSet[currentHash]) continue;
+            closedSet[currentHash] = true;
+
+            if (current.x == goalX && current.y == goalY) {
+                std::vector<Vector2> reversePath;
+                int cx = current.x;
+                int cy = current.y;
+                while (cx != -1 && cy != -1) {
+                    reversePath.push_back(room->TileToWorld(cx, cy));
+                    const LegacyNode& node = allNodes[hashCoord(cx, cy)];
+                    cx = node.parentX;
+                    cy = node.parentY;
+                }
+                for (int i = static_cast<int>(reversePath.size()) - 2; i >= 0; --i) {
+                    result.vectorPath.push_back(reversePath[i]);
+                }
+                return result;
+            }
+
+            for (auto& [nx, ny] : LegacyNeighbors(room, current.x, current.y)) {
+                int neighborHash = hashCoord(nx, ny);
+                if (closedSet[neighborHash]) continue;
+
+                float baseCost = (nx != current.x && ny != current.y) ? 1.414f : 1.0f;
+                float newGCost = current.gCost + baseCost;
+
+                auto it = allNodes.find(neighborHash);
+                if (it == allNodes.end() || newGCost < it->second.gCost) {
+                    LegacyNode neighbor{nx, ny, newGCost, heuristic(nx, ny, goalX, goalY), current.x, current.y};
+                    allNodes[neighborHash] = neighbor;
+                    openSet.push(neighbor);
+                }
+            }
+        }
+
+        result.error = true;
+        return result;
+    }
+
+    struct Query {
+        Room* room;
+        Vector2 start;
+        Vector2 goal;
+    };
+
+    struct RunResult {
+        double seconds;
+        long long allocations;
+        int found;
+    };
+
+    template <typename Fn>
+    RunResult Run(const std::vector<Query>& queries, int rounds, Fn&& findPath) {
+        RunResult run{0.0, 0, 0};
+        long long allocStart = Benchmarks::GetAllocationCount();
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; ++round) {
+            for (const Query& query : queries) {
+                if (findPath(query)) ++run.found;
+            }
+        }
+        run.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        run.allocations = Benchmarks::GetAllocationCount() - allocStart;
+        return run;
+    }
+
+    // Four requests complete in one Update() (the queue has no workers here).
+    // The first one's callback cancels the second, destroys the third's seeker
+    // and restarts the fourth: only the first and, an Update() later, the
+    // fourth's new request may be delivered.
+    bool CheckCancelFromCallback(const Query& query) {
+        PathRequestQueue& queue = PathRequestQueue::Instance();
+        PathQueueBudget savedBudget = queue.budget;
+        queue.budget = PathQueueBudget();
+        queue.budget.maxMilliseconds = 0.0f;
+
+        int first = 0, cancelled = 0, destroyed = 0, stale = 0, restarted = 0;
+        Seeker firstSeeker, cancelledSeeker, restartedSeeker;
+        auto destroyedSeeker = std::make_unique<Seeker>();
+
+        firstSeeker.StartPath(query.start, query.goal, query.room, [&](const Path&) {
+            ++first;
+            cancelledSeeker.CancelPath();
+            destroyedSeeker.reset();
+            restartedSeeker.StartPath(query.goal, query.start, query.room, [&](const Path&) { ++restarted; });
+        });
+        cancelledSeeker.StartPath(query.start, query.goal, query.room, [&](const Path&) { ++cancelled; });
+        destroyedSeeker->StartPath(query.start, query.goal, query.room, [&](const Path&) { ++destroyed; });
+        restartedSeeker.StartPath(query.start, query.goal, query.room, [&](const Path&) { ++stale; });
+
+        queue.BeginFrame();
+        queue.Update();
+        bool ok = first == 1 && cancelled == 0 && destroyed == 0 && stale == 0 && restarted == 0 &&
+                  queue.GetDeliveredLastFrame() == 1 && cancelledSeeker.IsDone() && !cancelledSeeker.HasPath() &&
+                  !restartedSeeker.IsDone();
+
+        queue.BeginFrame();
+        queue.Update();
+        ok = ok && restarted == 1 && stale == 0 && restartedSeeker.HasPath() && queue.GetDeliveredLastFrame() == 1;
+
+        queue.budget = savedBudget;
+        return ok;
+    }
+
+    // Three ticks in one frame with a two-search budget: two paths, not six
+    bool CheckFrameBudget(const Query& query) {
+        PathRequestQueue& queue = PathRequestQueue::Instance();
+        PathQueueBudget savedBudget = queue.budget;
+        queue.budget.maxRequestsPerFrame = 2;
+        queue.budget.maxMilliseconds = 0.0f;
+
+        int delivered = 0;
+        Seeker seekers[6];
+        for (Seeker& seeker : seekers) {
+            seeker.StartPath(query.start, query.goal, query.room, [&](const Path&) { ++delivered; });
+        }
+
+        queue.BeginFrame();
+        for (int tick = 0; tick < 3; ++tick) queue.Update();
+        bool ok = delivered == 2;
+
+        queue.BeginFrame();
+        queue.Update();
+        ok = ok && delivered == 4;
+
+        for (Seeker& seeker : seekers) seeker.CancelPath();
+        queue.budget = savedBudget;
+        return ok;
+    }
+}
+
+int Benchmarks::RunPathfinding() {
+    // A handful of generated rooms, each with an extra wall segment so
+    // paths have to detour instead of being straight lines
+    std::vector<std::unique_ptr<Room>> rooms;
+    for (int i = 0; i < 8; ++i) {
+        auto room = std::make_unique<Room>(i, RoomType::NORMAL, 0, 0);
+        room->Generate(1000u + i);
+        int wallX = 4 + i % 7;
+        for (int y = 1; y < Room::HEIGHT - 3; ++y) {
+            room->SetTile(wallX, (i & 1) ? Room::HEIGHT - 1 - y : y, TileType::WALL);
+        }
+        rooms.push_back(std::move(room));
+    }
+
+    std::mt19937 rng(99);
+    std::vector<Query> queries;
+    for (int i = 0; i < 2000; ++i) {
+        Room* room = rooms[i % rooms.size()].get();
+        auto randomFloor = [&]() {
+            while (true) {
+                int x = static_cast<int>(rng() % Room::WIDTH);
+                int y = static_cast<int>(rng() % Room::HEIGHT);
+                if (room->IsWalkable(x, y)) return room->TileToWorld(x, y);
+            }
+        };
+        queries.push_back({room, randomFloor(), randomFloor()});
+    }
+
+    Pathfinder& pathfinder = Pathfinder::Instance();
+    PathfinderConfig savedConfig = pathfinder.config;
+    pathfinder.config = PathfinderConfig();
+
+    const int rounds = 20;
+    const double total = static_cast<double>(queries.size()) * rounds;
+
+    RunResult legacy = Run(queries, rounds, [](const Query& q) {
+        return !LegacyFindPath(q.room, q.start, q.goal).error;
+    });
+
+    // Warm-up pass so the search arrays and the reused Path are sized
+    Path path;
+    for (const Query& q : queries) pathfinder.FindPath(q.room, q.start, q.goal, path);
+
+    RunResult current = Run(queries, rounds, [&](const Query& q) {
+        return pathfinder.FindPath(q.room, q.start, q.goal, path);
+    });
+
+    // Any query with a route works for the delivery check
+    bool cancelOk = false;
+    bool budgetOk = false;
+    for (const Query& q : queries) {
+        if (!pathfinder.FindPath(q.room, q.start, q.goal, path)) continue;
+        cancelOk = CheckCancelFromCallback(q);
+        budgetOk = CheckFrameBudget(q);
+        break;
+    }
+
+    pathfinder.config = savedConfig;
+
+    printf("%-10s %14s %16s %10s\n", "", "paths/sec", "allocs/path", "found");
+    printf("%-10s %14.0f %16.2f %10d\n", "legacy", total / legacy.seconds, legacy.allocations / total, legacy.found);
+    printf("%-10s %14.0f %16.2f %10d\n", "current", total / current.seconds, current.allocations / total, current.found);
+    printf("cancel from a path callback: %s\n", cancelOk ? "ok" : "FAILED (a cancelled request was delivered)");
+    printf("search budget across ticks: %s\n", budgetOk ? "ok" : "FAILED (refilled within a frame)");
+
+    return legacy.found == current.found && current.allocations == 0 && cancelOk && budgetOk ? 0 : 1;
+}
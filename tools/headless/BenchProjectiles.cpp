@@ -0,0 +1,48 @@
+// ============================================================================
+// Projectile benchmark
+// Times ProjectileManager::Update (integration kernel + swap-remove
+// compaction) at bullet-hell densities. Every 8th projectile is marked for
+// destruction each frame to keep the compaction path busy.
+// ============================================================================
+#include "Benchmarks.hpp"
+#include "Projectile.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+int Benchmarks::RunProjectiles() {
+    const int counts[] = {1000, 20000, 100000};
+    const int frames = 120;
+    const float dt = 1.0f / 60.0f;
+
+    printf("kernel: %s\n", ProjectileManager::GetKernelName());
+    printf("%10s %14s %14s\n", "spawned", "update ms/frm", "live at end");
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> angle(0.0f, 2.0f * PI);
+    std::uniform_real_distribution<float> speed(200.0f, 600.0f);
+
+    for (int count : counts) {
+        ProjectileManager projectiles;
+        for (int i = 0; i < count; ++i) {
+            float a = angle(rng);
+            projectiles.SpawnProjectile({0.0f, 0.0f}, {cosf(a), sinf(a)}, speed(rng), 1, (i & 1) == 0);
+        }
+
+        double totalMs = 0.0;
+        for (int frame = 0; frame < frames; ++frame) {
+            for (int i = frame % 8; i < projectiles.GetCount(); i += 64) {
+                projectiles.MarkForDestroy(i);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            projectiles.Update(dt);
+            totalMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        printf("%10d %14.4f %14d\n", count, totalMs / frames, projectiles.GetCount());
+    }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+// ============================================================================
+// Line-of-sight benchmark
+// Compares the old fixed-step sampling (every 20 world units) with the exact
+// grid traversal and the per-room table, and counts how often sampling
+// reported a clear line that actually clips a wall.
+// ============================================================================
+#include "Benchmarks.hpp"
+#include "Dungeon.hpp"
+#include "Visibility.hpp"
+#include "raymath.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+    bool SampledLineOfSight(const Room& room, Vector2 from, Vector2 to) {
+        Vector2 delta = Vector2Subtract(to, from);
+        int steps = static_cast<int>(Vector2Length(delta) / 20.0f);
+        if (steps < 1) steps = 1;
+
+        Vector2 step = Vector2Scale(delta, 1.0f / steps);
+        Vector2 checkPos = from;
+        for (int i = 0; i < steps; ++i) {
+            checkPos = Vector2Add(checkPos, step);
+            if (!room.IsWalkableAt(checkPos)) return false;
+        }
+        return true;
+    }
+
+    struct Query {
+        const Room* room;
+        Vector2 from;
+        Vector2 to;
+    };
+
+    template <typename Fn>
+    long long Time(const char* label, const std::vector<Query>& queries, int rounds, Fn&& los) {
+        long long visible = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; ++round) {
+            for (const Query& q : queries) {
+                visible += los(*q.room, q.from, q.to) ? 1 : 0;
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double total = static_cast<double>(queries.size()) * rounds;
+        printf("%-10s %14.2f %12.1f %12.1f%%\n", label, total / seconds / 1e6,
+               seconds * 1e9 / total, 100.0 * visible / total);
+        return visible;
+    }
+}
+
+int Benchmarks::RunVisibility() {
+    std::vector<std::unique_ptr<Room>> rooms;
+    auto buildStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < 16; ++i) {
+        auto room = std::make_unique<Room>(i, RoomType::NORMAL, i % 4, i / 4);
+        room->Generate(500u + i);
+        rooms.push_back(std::move(room));
+    }
+    double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+
+    // Random pairs of walkable positions (anywhere inside their tiles)
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> inTile(2.0f, Room::TILE_SIZE - 2.0f);
+    std::vector<Query> queries;
+    for (int i = 0; i < 20000; ++i) {
+        const Room* room = rooms[i % rooms.size()].get();
+        auto randomPos = [&]() {
+            while (true) {
+                int x = static_cast<int>(rng() % Room::WIDTH);
+                int y = static_cast<int>(rng() % Room::HEIGHT);
+                if (!room->IsWalkable(x, y)) continue;
+                Vector2 origin = room->GetWorldPosition();
+                return Vector2{origin.x + x * Room::TILE_SIZE + inTile(rng),
+                               origin.y + y * Room::TILE_SIZE + inTile(rng)};
+            }
+        };
+        queries.push_back({room, randomPos(), randomPos()});
+    }
+
+    int missedWalls = 0;
+    for (const Query& q : queries) {
+        if (SampledLineOfSight(*q.room, q.from, q.to) && !Visibility::Raycast(*q.room, q.from, q.to)) {
+            ++missedWalls;
+        }
+    }
+
+    printf("16 rooms generated with tables in %.2f ms\n", buildMs);
+    printf("%-10s %14s %12s %12s\n", "", "Mqueries/sec", "ns/query", "visible");
+    const int rounds = 50;
+    Time("sampled", queries, rounds, SampledLineOfSight);
+    Time("raycast", queries, rounds, [](const Room& r, Vector2 a, Vector2 b) { return Visibility::Raycast(r, a, b); });
+    Time("table", queries, rounds, Visibility::HasLineOfSight);
+    printf("sampling saw through walls in %d of %zu queries\n", missedWalls, queries.size());
+
+    return 0;
+}
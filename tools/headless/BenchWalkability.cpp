@@ -0,0 +1,98 @@
+// ============================================================================
+// Walkability benchmark
+// Point queries against the previous tile layout (a vector of row vectors of
+// 4-byte TileType, kept here as a baseline) and against Room's flat storage
+// with its walkability bitmask, at random world positions in and around a
+// room - the same shape of query projectiles and line-of-sight checks make.
+// ============================================================================
+#include "Benchmarks.hpp"
+#include "Dungeon.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    class LegacyTiles {
+    public:
+        explicit LegacyTiles(const Room& room)
+            : m_room(room)
+            , m_tiles(Room::HEIGHT, std::vector<TileType>(Room::WIDTH, TileType::FLOOR))
+        {
+            for (int y = 0; y < Room::HEIGHT; ++y) {
+                for (int x = 0; x < Room::WIDTH; ++x) {
+                    m_tiles[y][x] = room.GetTile(x, y);
+                }
+            }
+        }
+
+        // Kept out of line like the original Room/DungeonManager calls
+        [[gnu::noinline]] TileType GetTile(int x, int y) const {
+            if (x < 0 || x >= Room::WIDTH || y < 0 || y >= Room::HEIGHT) {
+                return TileType::VOID;
+            }
+            return m_tiles[y][x];
+        }
+
+        [[gnu::noinline]] bool IsWalkable(Vector2 worldPos) const {
+            Vector2 roomPos = m_room.GetWorldPosition();
+            int tileX = static_cast<int>((worldPos.x - roomPos.x) / Room::TILE_SIZE);
+            int tileY = static_cast<int>((worldPos.y - roomPos.y) / Room::TILE_SIZE);
+            if (tileX < 0 || tileX >= Room::WIDTH || tileY < 0 || tileY >= Room::HEIGHT) {
+                return false;
+            }
+            TileType tile = GetTile(tileX, tileY);
+            return tile == TileType::FLOOR || tile == TileType::DOOR;
+        }
+
+    private:
+        const Room& m_room;
+        std::vector<std::vector<TileType>> m_tiles;
+    };
+
+    template <typename Fn>
+    void Report(const char* label, const std::vector<Vector2>& points, int rounds, Fn&& isWalkable) {
+        long long walkable = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; ++round) {
+            for (const Vector2& p : points) {
+                walkable += isWalkable(p) ? 1 : 0;
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double queries = static_cast<double>(points.size()) * rounds;
+        printf("%-10s %14.1f %12.2f %12lld\n", label, queries / seconds / 1e6,
+               seconds * 1e9 / queries, walkable);
+    }
+}
+
+int Benchmarks::RunWalkability() {
+    Room room(3, RoomType::NORMAL, 2, 1);
+    room.Generate(77);
+    LegacyTiles legacy(room);
+
+    // Mostly inside the room, some just outside its edges
+    Vector2 origin = room.GetWorldPosition();
+    float w = static_cast<float>(Room::WIDTH * Room::TILE_SIZE);
+    float h = static_cast<float>(Room::HEIGHT * Room::TILE_SIZE);
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> px(origin.x - 24.0f, origin.x + w + 24.0f);
+    std::uniform_real_distribution<float> py(origin.y - 24.0f, origin.y + h + 24.0f);
+
+    std::vector<Vector2> points(1 << 16);
+    for (Vector2& p : points) p = {px(rng), py(rng)};
+
+    const int rounds = 200;
+    printf("%-10s %14s %12s %12s\n", "", "Mqueries/sec", "ns/query", "walkable");
+    Report("legacy", points, rounds, [&](Vector2 p) { return legacy.IsWalkable(p); });
+    Report("bitmask", points, rounds, [&](Vector2 p) { return room.IsWalkableAt(p); });
+
+    // Both layouts must agree on every point
+    for (const Vector2& p : points) {
+        if (legacy.IsWalkable(p) != room.IsWalkableAt(p)) {
+            printf("MISMATCH at (%.1f, %.1f)\n", p.x, p.y);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include "Benchmarks.hpp"
+#include "Game.hpp"
+#include "Enemy.hpp"
+#include "Dungeon.hpp"
+#include "Pathfinding.hpp"
+#include <random>
+
+std::vector<Vector2> Benchmarks::SetUpEnemyRoom() {
+    GameConfig config;
+    config.headless = true;
+    config.seed = 99;
+    config.pathWorkers = 0;
+    config.jobWorkers = 0;
+
+    Game& game = Game::Instance();
+    game.Init(config);
+    PathRequestQueue::Instance().budget.maxMilliseconds = 0.0f;
+    game.EnterPortal();
+    game.StartGameWithBuff(0);
+
+    Room* room = game.GetDungeon()->GetCurrentRoom();
+
+    std::vector<Vector2> spawnPoints;
+    Vector2 roomPos = room->GetWorldPosition();
+    for (int y = 0; y < Room::HEIGHT; ++y) {
+        for (int x = 0; x < Room::WIDTH; ++x) {
+            if (!room->IsWalkable(x, y)) continue;
+            spawnPoints.push_back({roomPos.x + x * Room::TILE_SIZE, roomPos.y + y * Room::TILE_SIZE});
+        }
+    }
+    return spawnPoints;
+}
+
+void Benchmarks::SpawnCrowd(EnemyManager& enemies, const std::vector<Vector2>& spawnPoints, int count, uint32_t seed) {
+    std::uniform_real_distribution<float> jitter(8.0f, Room::TILE_SIZE - 8.0f);
+    std::uniform_int_distribution<int> pickPoint(0, static_cast<int>(spawnPoints.size()) - 1);
+    std::uniform_int_distribution<int> pickType(0, static_cast<int>(EnemyType::GOBLIN));
+
+    std::mt19937 rng(seed);
+    for (int i = 0; i < count; ++i) {
+        Vector2 tile = spawnPoints[pickPoint(rng)];
+        enemies.SpawnEnemy(static_cast<EnemyType>(pickType(rng)),
+                           {tile.x + jitter(rng), tile.y + jitter(rng)});
+    }
+}
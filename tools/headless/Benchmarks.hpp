@@ -0,0 +1,36 @@
+#pragma once
+
+#include "raylib.h"
+#include <cstdint>
+#include <vector>
+
+class EnemyManager;
+
+// ============================================================================
+// Micro-benchmarks - selected with `EpitomeHeadless --bench NAME`
+// Each returns a process exit code (0 = ran and results were consistent).
+// ============================================================================
+namespace Benchmarks {
+    int RunBroadphase();
+    int RunProjectiles();
+    int RunPathfinding();
+    int RunWalkability();
+    int RunVisibility();
+    int RunAssetLoad();
+    int RunEnemies();
+    int RunEnemyScaling();
+    int RunCrowd();
+
+    // Heap allocations made by this process so far (operator new calls)
+    long long GetAllocationCount();
+
+    // Shared fixture for the enemy benches: a headless game (fixed seed, no
+    // path or job workers, no path time budget) started and standing in its
+    // first room. Returns the top-left corner of every walkable tile there.
+    // Call Game::Instance().Shutdown() when done.
+    std::vector<Vector2> SetUpEnemyRoom();
+
+    // Add count minion-type enemies at random spawn points, jittered inside
+    // the tile. The same seed gives the same layout.
+    void SpawnCrowd(EnemyManager& enemies, const std::vector<Vector2>& spawnPoints, int count, uint32_t seed);
+}
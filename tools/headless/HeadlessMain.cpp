@@ -0,0 +1,185 @@
+// ============================================================================
+// Headless simulation driver
+// Runs Game::Tick() at the game's fixed step (or an explicit dt) with no window, GPU or rendering, driven by
+// SimBot through a scripted input provider. Used for soak tests and perf
+// regression runs on display-less CI machines.
+//
+// Usage: EpitomeHeadless [--floors N] [--ticks N] [--seed S] [--dt SECONDS]
+//                        [--tick-rate HZ] [--path-workers N] [--job-workers N]
+//                        [--trace FILE] [--ai-lod on|off] [--crowd on|off]
+//        EpitomeHeadless --bench NAME
+// ============================================================================
+#include "Benchmarks.hpp"
+#include "Game.hpp"
+#include "Enemy.hpp"
+#include "Input.hpp"
+#include "Pathfinding.hpp"
+#include "SimBot.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+    struct HeadlessOptions {
+        int floors = 10;              // Stop after this many cleared floors
+        long long maxTicks = 2000000; // Hard stop
+        unsigned int seed = 1;
+        int tickRate = GameConfig().tickRate;
+        float dt = 0.0f;              // 0 = one fixed step (1 / tickRate)
+        int pathWorkers = 0;          // 0 keeps runs deterministic for a given seed
+        int jobWorkers = 0;           // Results are the same for any count; 0 keeps timings single-threaded
+        const char* bench = nullptr;  // Run a micro-benchmark instead of the sim
+        const char* trace = nullptr;  // Chrome trace of the profiled zones, written at exit
+        bool aiLod = true;            // Enemy think scheduling (off: every enemy thinks every tick)
+        bool crowd = true;            // Enemy crowd separation
+    };
+
+    struct BenchEntry {
+        const char* name;
+        int (*run)();
+    };
+
+    const BenchEntry BENCHMARKS[] = {
+        {"broadphase",  Benchmarks::RunBroadphase},
+        {"projectiles", Benchmarks::RunProjectiles},
+        {"pathfinding", Benchmarks::RunPathfinding},
+        {"walkability", Benchmarks::RunWalkability},
+        {"visibility",  Benchmarks::RunVisibility},
+        {"asset-load",  Benchmarks::RunAssetLoad},
+        {"enemies",     Benchmarks::RunEnemies},
+        {"enemy-scaling", Benchmarks::RunEnemyScaling},
+        {"crowd",       Benchmarks::RunCrowd},
+    };
+
+    void PrintUsage() {
+        printf("Usage: EpitomeHeadless [--floors N] [--ticks N] [--seed S] [--dt SECONDS]\n");
+        printf("                       [--tick-rate HZ] [--path-workers N] [--job-workers N]\n");
+        printf("                       [--trace FILE] [--ai-lod on|off] [--crowd on|off]\n");
+        printf("       EpitomeHeadless --bench NAME\n");
+        printf("Benchmarks:");
+        for (const BenchEntry& entry : BENCHMARKS) printf(" %s", entry.name);
+        printf("\n");
+    }
+
+    int RunBenchmark(const char* name) {
+        for (const BenchEntry& entry : BENCHMARKS) {
+            if (strcmp(entry.name, name) == 0) return entry.run();
+        }
+        PrintUsage();
+        return 1;
+    }
+
+    bool ParseArgs(int argc, char** argv, HeadlessOptions& options) {
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            bool hasValue = i + 1 < argc;
+
+            if (strcmp(arg, "--floors") == 0 && hasValue) {
+                options.floors = atoi(argv[++i]);
+            } else if (strcmp(arg, "--ticks") == 0 && hasValue) {
+                options.maxTicks = atoll(argv[++i]);
+            } else if (strcmp(arg, "--seed") == 0 && hasValue) {
+                options.seed = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+            } else if (strcmp(arg, "--dt") == 0 && hasValue) {
+                options.dt = static_cast<float>(atof(argv[++i]));
+                if (options.dt <= 0.0f) return false;
+            } else if (strcmp(arg, "--tick-rate") == 0 && hasValue) {
+                options.tickRate = atoi(argv[++i]);
+            } else if (strcmp(arg, "--path-workers") == 0 && hasValue) {
+                options.pathWorkers = atoi(argv[++i]);
+            } else if (strcmp(arg, "--job-workers") == 0 && hasValue) {
+                options.jobWorkers = atoi(argv[++i]);
+            } else if (strcmp(arg, "--trace") == 0 && hasValue) {
+                options.trace = argv[++i];
+            } else if (strcmp(arg, "--ai-lod") == 0 && hasValue) {
+                const char* value = argv[++i];
+                if (strcmp(value, "on") != 0 && strcmp(value, "off") != 0) return false;
+                options.aiLod = strcmp(value, "on") == 0;
+            } else if (strcmp(arg, "--crowd") == 0 && hasValue) {
+                const char* value = argv[++i];
+                if (strcmp(value, "on") != 0 && strcmp(value, "off") != 0) return false;
+                options.crowd = strcmp(value, "on") == 0;
+            } else if (strcmp(arg, "--bench") == 0 && hasValue) {
+                options.bench = argv[++i];
+            } else {
+                return false;
+            }
+        }
+        if (options.tickRate <= 0) return false;
+        if (options.dt == 0.0f) options.dt = 1.0f / static_cast<float>(options.tickRate);
+        return options.seed != 0 && options.pathWorkers >= 0 && options.jobWorkers >= 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    HeadlessOptions options;
+    if (!ParseArgs(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    if (options.bench) {
+        return RunBenchmark(options.bench);
+    }
+
+    ScriptedInputProvider input;
+    Input::SetProvider(&input);
+
+    GameConfig config;
+    config.headless = true;
+    config.seed = options.seed;
+    config.pathWorkers = options.pathWorkers;
+    config.jobWorkers = options.jobWorkers;
+    config.tickRate = options.tickRate;
+    config.tracePath = options.trace;
+
+    Game& game = Game::Instance();
+    game.Init(config);
+    
+    if (options.pathWorkers == 0) {
+        // A wall-clock budget would make results depend on machine speed
+        PathRequestQueue::Instance().budget.maxMilliseconds = 0.0f;
+    }
+    game.GetEnemies()->aiSchedule.enabled = options.aiLod;
+    game.GetEnemies()->crowd.enabled = options.crowd;
+
+    SimBot bot(options.seed);
+
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    double worstTickMs = 0.0;
+    long long ticks = 0;
+
+    while (ticks < options.maxTicks && bot.GetFloorsCleared() < options.floors) {
+        bot.Think(game, input, options.dt);
+
+        auto tickStart = Clock::now();
+        PathRequestQueue::Instance().BeginFrame();  // No rendering: every tick is a frame
+        game.Tick(options.dt);
+        double tickMs = std::chrono::duration<double, std::milli>(Clock::now() - tickStart).count();
+        if (tickMs > worstTickMs) worstTickMs = tickMs;
+
+        input.EndFrame();
+        ++ticks;
+    }
+
+    double wallSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    double simSeconds = ticks * static_cast<double>(options.dt);
+
+    printf("floors cleared : %d\n", bot.GetFloorsCleared());
+    printf("runs finished  : %d\n", bot.GetRunsFinished());
+    printf("room timeouts  : %d\n", bot.GetRoomTimeouts());
+    printf("ticks          : %lld (%.1f s simulated)\n", ticks, simSeconds);
+    printf("wall time      : %.3f s (%.0fx real time)\n", wallSeconds,
+           wallSeconds > 0.0 ? simSeconds / wallSeconds : 0.0);
+    printf("tick cost      : %.4f ms avg, %.4f ms worst\n",
+           ticks > 0 ? wallSeconds * 1000.0 / ticks : 0.0, worstTickMs);
+
+    game.Shutdown();
+    Input::SetProvider(nullptr);
+
+    return bot.GetFloorsCleared() >= options.floors ? 0 : 2;
+}
@@ -0,0 +1,224 @@
+#include "SimBot.hpp"
+#include "Game.hpp"
+#include "Player.hpp"
+#include "Dungeon.hpp"
+#include "Enemy.hpp"
+#include "Pathfinding.hpp"
+#include "raymath.h"
+#include <queue>
+#include <unordered_map>
+
+SimBot::SimBot(unsigned int seed) : m_rng(seed) {
+}
+
+void SimBot::Think(Game& game, ScriptedInputProvider& input, float dt) {
+    input.ReleaseAll();
+
+    GameState state = game.GetState();
+    int stateId = static_cast<int>(state);
+    bool stateChanged = stateId != m_lastState;
+    m_lastState = stateId;
+
+    switch (state) {
+        case GameState::MENU:
+        case GameState::GAME_OVER:
+            input.PressKey(KEY_ENTER);
+            break;
+
+        case GameState::HUB:
+            game.EnterPortal();
+            break;
+
+        case GameState::BUFF_SELECT: {
+            int count = game.GetStartingBuffCount();
+            int pick = count > 0 ? static_cast<int>(m_rng() % count) : 0;
+            game.StartGameWithBuff(pick);
+            break;
+        }
+
+        case GameState::FLOOR_CLEAR: {
+            if (stateChanged) {
+                ++m_floorsCleared;
+            }
+            int count = game.GetStartingBuffCount();
+            int pick = count > 0 ? static_cast<int>(m_rng() % count) : 0;
+            game.ApplyFloorBuff(pick);
+            break;
+        }
+
+        case GameState::RUN_RESULTS:
+            if (stateChanged) {
+                ++m_runsFinished;
+            }
+            input.PressKey(KEY_ENTER);
+            break;
+
+        case GameState::PAUSED:
+            input.PressKey(KEY_ESCAPE);
+            break;
+
+        case GameState::PLAYING:
+            ThinkPlaying(game, input, dt);
+            break;
+    }
+}
+
+void SimBot::ThinkPlaying(Game& game, ScriptedInputProvider& input, float dt) {
+    Player* player = game.GetPlayer();
+    DungeonManager* dungeon = game.GetDungeon();
+    if (!player || !dungeon || !dungeon->GetCurrentRoom()) return;
+
+    Room* room = dungeon->GetCurrentRoom();
+    if (room != m_lastRoom) {
+        m_lastRoom = room;
+        m_roomTimer = 0.0f;
+        m_path.clear();
+        m_repathTimer = 0.0f;
+    }
+
+    m_roomTimer += dt;
+    if (m_roomTimer > roomTimeLimit && game.GetEnemies()->GetActiveCount() > 0) {
+        // Unreachable enemy or a bad spawn - don't let one room stall the soak run
+        game.DebugClearEnemies();
+        ++m_roomTimeouts;
+        m_roomTimer = 0.0f;
+    }
+
+    bool hasEnemyTarget = false;
+    Vector2 goal = PickGoal(game, hasEnemyTarget);
+
+    if (hasEnemyTarget) {
+        // Auto-aim does the aiming, the bot only has to pull the trigger
+        input.SetMouseButtonDown(MOUSE_BUTTON_LEFT, true);
+
+        float dist = Vector2Distance(player->GetPosition(), goal);
+        if (dist < 100.0f && player->GetAbilityCooldownPercent() <= 0.0f &&
+            player->GetEnergy() > player->GetMaxEnergy() / 2) {
+            input.PressKey(KEY_SPACE);
+        }
+
+        // Keep some distance instead of walking into melee range
+        if (dist < 140.0f) {
+            Vector2 away = Vector2Normalize(Vector2Subtract(player->GetPosition(), goal));
+            Vector2 strafe = {-away.y, away.x};
+            goal = Vector2Add(player->GetPosition(), Vector2Scale(Vector2Add(away, strafe), 48.0f));
+        }
+    }
+
+    SteerToward(game, room, goal, input, dt);
+}
+
+Vector2 SimBot::PickGoal(Game& game, bool& hasEnemyTarget) {
+    Player* player = game.GetPlayer();
+    DungeonManager* dungeon = game.GetDungeon();
+    Vector2 playerPos = player->GetPosition();
+
+    EnemyManager* enemies = game.GetEnemies();
+    int nearest = enemies->GetNearestEnemy(playerPos, 100000.0f);
+    if (nearest >= 0) {
+        hasEnemyTarget = true;
+        return enemies->GetPosition(nearest);
+    }
+
+    if (dungeon->IsPortalActive()) {
+        return dungeon->GetPortalPosition();
+    }
+
+    Vector2 doorPos;
+    if (FindDoorTowardUnclearedRoom(game, doorPos)) {
+        return doorPos;
+    }
+
+    return playerPos;
+}
+
+bool SimBot::FindDoorTowardUnclearedRoom(Game& game, Vector2& doorPos) {
+    DungeonManager* dungeon = game.GetDungeon();
+    Room* start = dungeon->GetCurrentRoom();
+
+    // BFS over the room graph, remembering which door of the current room
+    // each branch started from
+    std::queue<int> open;
+    std::unordered_map<int, int> firstDoor;  // room id -> door index in start room
+
+    auto& startDoors = start->GetDoors();
+    for (size_t i = 0; i < startDoors.size(); ++i) {
+        int id = startDoors[i].connectedRoomId;
+        if (firstDoor.count(id) || id == start->GetId()) continue;
+        firstDoor[id] = static_cast<int>(i);
+        open.push(id);
+    }
+
+    while (!open.empty()) {
+        int id = open.front();
+        open.pop();
+
+        Room* room = dungeon->GetRoom(id);
+        if (!room) continue;
+
+        if (!room->IsCleared()) {
+            doorPos = startDoors[firstDoor[id]].position;
+            return true;
+        }
+
+        for (const auto& door : room->GetDoors()) {
+            int next = door.connectedRoomId;
+            if (next == start->GetId() || firstDoor.count(next)) continue;
+            firstDoor[next] = firstDoor[id];
+            open.push(next);
+        }
+    }
+
+    return false;
+}
+
+void SimBot::SteerToward(Game& game, Room* room, Vector2 goal,
+                         ScriptedInputProvider& input, float dt) {
+    Vector2 pos = game.GetPlayer()->GetPosition();
+
+    // Repath periodically or when the goal moved a lot
+    m_repathTimer -= dt;
+    if (m_repathTimer <= 0.0f || Vector2Distance(goal, m_pathGoal) > Room::TILE_SIZE) {
+        m_path = Pathfinder::FindPathStatic(room, pos, goal);
+        m_pathGoal = goal;
+        m_repathTimer = 0.25f;
+    }
+
+    Vector2 target = Pathfinder::GetNextWaypoint(m_path, pos, 12.0f);
+    if (m_path.empty()) {
+        target = goal;
+    }
+
+    // Stuck detection - wander for a moment if we stopped making progress
+    if (Vector2Distance(pos, m_lastProgressPos) > 8.0f) {
+        m_lastProgressPos = pos;
+        m_stuckTimer = 0.0f;
+    } else {
+        m_stuckTimer += dt;
+    }
+
+    if (m_stuckTimer > 1.5f && m_wanderTimer <= 0.0f) {
+        std::uniform_real_distribution<float> angle(0.0f, 2.0f * PI);
+        float a = angle(m_rng);
+        m_wanderDir = {cosf(a), sinf(a)};
+        m_wanderTimer = 0.5f;
+        m_stuckTimer = 0.0f;
+    }
+
+    Vector2 dir;
+    if (m_wanderTimer > 0.0f) {
+        m_wanderTimer -= dt;
+        dir = m_wanderDir;
+    } else {
+        dir = Vector2Subtract(target, pos);
+        if (Vector2Length(dir) < 4.0f) return;
+    }
+
+    // Map the direction onto WASD (8 directions)
+    const float deadZone = 0.38f;  // ~sin(22.5 degrees)
+    dir = Vector2Normalize(dir);
+    if (dir.y < -deadZone) input.SetKeyDown(KEY_W, true);
+    if (dir.y > deadZone) input.SetKeyDown(KEY_S, true);
+    if (dir.x < -deadZone) input.SetKeyDown(KEY_A, true);
+    if (dir.x > deadZone) input.SetKeyDown(KEY_D, true);
+}
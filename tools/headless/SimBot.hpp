@@ -0,0 +1,56 @@
+#pragma once
+
+#include "raylib.h"
+#include "Input.hpp"
+#include <random>
+#include <vector>
+
+class Game;
+class Room;
+
+// ============================================================================
+// SimBot - Plays the game through a ScriptedInputProvider
+// Walks the menus, fights whatever is in the room, then heads for the next
+// uncleared room (or the portal). Good enough to push the simulation through
+// floor after floor without a human.
+// ============================================================================
+class SimBot {
+public:
+    explicit SimBot(unsigned int seed);
+
+    // Decide input for the next tick (menus are advanced through the Game API)
+    void Think(Game& game, ScriptedInputProvider& input, float dt);
+
+    // Stats
+    int GetFloorsCleared() const { return m_floorsCleared; }
+    int GetRunsFinished() const { return m_runsFinished; }
+    int GetRoomTimeouts() const { return m_roomTimeouts; }
+
+    // Seconds of sim time the bot may spend in one room before giving up on it
+    float roomTimeLimit = 60.0f;
+
+private:
+    void ThinkPlaying(Game& game, ScriptedInputProvider& input, float dt);
+    Vector2 PickGoal(Game& game, bool& hasEnemyTarget);
+    bool FindDoorTowardUnclearedRoom(Game& game, Vector2& doorPos);
+    void SteerToward(Game& game, Room* room, Vector2 goal, ScriptedInputProvider& input, float dt);
+
+    std::mt19937 m_rng;
+    int m_lastState = -1;
+    int m_floorsCleared = 0;
+    int m_runsFinished = 0;
+    int m_roomTimeouts = 0;
+
+    // Navigation
+    std::vector<Vector2> m_path;
+    Vector2 m_pathGoal = {0, 0};
+    float m_repathTimer = 0.0f;
+    Room* m_lastRoom = nullptr;
+    float m_roomTimer = 0.0f;
+
+    // Stuck detection
+    Vector2 m_lastProgressPos = {0, 0};
+    float m_stuckTimer = 0.0f;
+    float m_wanderTimer = 0.0f;
+    Vector2 m_wanderDir = {0, 0};
+};
@@ -0,0 +1,53 @@
+// ============================================================================
+// Asset packer
+// Decodes the loose sprite PNGs once, offline, and writes them as a single
+// pre-decoded pack (see AssetPack.hpp) that the game memory-maps at startup.
+// Sprites are found the same way the game finds loose files: by
+// SpriteManager's default filename for each SpriteType.
+//
+// Usage: EpitomePacker SPRITE_DIR OUTPUT.pak
+// ============================================================================
+#include "AssetPack.hpp"
+#include "SpriteManager.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        printf("Usage: EpitomePacker SPRITE_DIR OUTPUT.pak\n");
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    std::string directory = argv[1];
+    if (!directory.empty() && directory.back() != '/' && directory.back() != '\\') {
+        directory += '/';
+    }
+
+    std::vector<AssetPack::Source> sources;
+    size_t bytes = 0;
+    for (int i = 0; i < static_cast<int>(SpriteType::COUNT); ++i) {
+        SpriteType type = static_cast<SpriteType>(i);
+        std::string path = directory + SpriteManager::GetDefaultFilename(type);
+        if (!FileExists(path.c_str())) continue;
+
+        Image image = LoadImage(path.c_str());
+        if (!image.data) {
+            printf("warning: failed to decode %s\n", path.c_str());
+            continue;
+        }
+        bytes += static_cast<size_t>(image.width) * image.height * 4;
+        sources.push_back({SpriteManager::GetSpriteName(type), image});
+    }
+
+    bool ok = AssetPack::Write(argv[2], sources);
+    for (AssetPack::Source& source : sources) {
+        UnloadImage(source.image);
+    }
+    if (!ok) return 1;
+
+    printf("packed %zu sprites (%.1f KiB of pixels) into %s\n", sources.size(), bytes / 1024.0, argv[2]);
+    return 0;
+}